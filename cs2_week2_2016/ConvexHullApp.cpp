@@ -50,6 +50,8 @@
 
 void DoGiftWrap(vector<Tuple*> points, ConvexHullApp *app);
 void DoGrahamScan(vector<Tuple*> points, ConvexHullApp *app);
+void DoMonotoneChain(vector<Tuple*> points, ConvexHullApp *app);
+void DoChan(vector<Tuple*> points, ConvexHullApp *app);
 
 /**
  * @brief Randomly generates points within the screen.
@@ -173,6 +175,18 @@ void ConvexHullApp::OnEvent(SDL_Event* event)
             delete_hull();
             DoGrahamScan(points, this);
         }
+        else if (event->key.keysym.unicode == 'm')
+        {
+            // Run monotone chain algorithm.
+            delete_hull();
+            DoMonotoneChain(points, this);
+        }
+        else if (event->key.keysym.unicode == 'c')
+        {
+            // Run Chan's algorithm.
+            delete_hull();
+            DoChan(points, this);
+        }
     }
 }
 
@@ -9,10 +9,19 @@
  * (implementation).
  *
  */
+#include <algorithm>
 #include "HullAlgorithms.h"
 
 #define PI 3.14159265
 
+/**
+ * @brief Chan's algorithm looks for tangents to hulls with at least this
+ * many points with a binary search, and to smaller ones one point at a time.
+ */
+#ifndef TANGENT_SEARCH_MIN
+#define TANGENT_SEARCH_MIN 16
+#endif
+
 /**
  * TO STUDENTS: In all of the following functions, feel free to change the
  * function arguments and/or write helper functions as you see fit. Remember to
@@ -36,14 +45,16 @@
  * 			start from step 1 with this point.
  * 3. End when the starting point is the same as the leftmost point.
  */
-void DoGiftWrap(vector<Tuple*> points, ConvexHullApp *app)
+void giftWrap(const PointSet &points, vector<int> &hull)
 {
+	hull.clear();
+	if (points.size() == 0) return;
 	// A point that is definitely on the hull is the left most point
     unsigned int leftPt = leftMost(points);
     // Initialize a variable to check when the hull has started to move
     // in the negative x direction
 	bool startNeg = false;
-    app->add_to_hull(points[leftPt]);
+    hull.push_back(leftPt);
     unsigned int startPt = leftPt;
     // Save a list of points on the hull to avoid repetition
     vector<int> onHull;
@@ -65,41 +76,41 @@ void DoGiftWrap(vector<Tuple*> points, ConvexHullApp *app)
 			}
 			// It can't move in the positive x direction if we have already
 			// started moving in the negative x direction
-			else if (startNeg && dxPos(points[startPt], points[smallestAngle])) {
-				if (points[smallestAngle]->x - points[startPt]->x == 0) {
+			else if (startNeg && dxPos(points, startPt, smallestAngle)) {
+				if (points.x[smallestAngle] - points.x[startPt] == 0) {
 					whereDx = smallestAngle;
 				}
 				smallestAngle ++;
 			}
 			else break;
 		}
-		if (whereDx >= 0 && (startNeg && dxPos(points[startPt], points[smallestAngle]))) {
+		if (whereDx >= 0 && (startNeg && dxPos(points, startPt, smallestAngle))) {
 			smallestAngle = whereDx;
 		}
 		// Finds the size of the angle between this point that we have
 		// chosen to compare other points to and the start point
-		double smallAng = angle(points[startPt], points[smallestAngle]);
+		double smallAng = angle(points, startPt, smallestAngle);
 		// Actually finds the ppint with the smallest angle, taking into
 		// account the checks from before
 		for (unsigned int i = 1; i < points.size(); i++) {
 			if (checkOnHull(i, onHull) || i == startPt) continue;
-			if (startNeg && dxPos(points[startPt], points[i]))
+			if (startNeg && dxPos(points, startPt, i))
 				continue;
-			double currentAng = angle(points[startPt], points[i]);
+			double currentAng = angle(points, startPt, i);
 			if (currentAng < smallAng) {
 				smallestAngle = i;
-				smallAng = angle(points[startPt], points[smallestAngle]);
+				smallAng = angle(points, startPt, smallestAngle);
 			}
 		}
 		// Adds this point to the hull
-		app->add_to_hull(points[smallestAngle]);
+		hull.push_back(smallestAngle);
 		onHull.push_back(smallestAngle);
 		// If we have started moving in the negative direction
-		if (!startNeg && !dxPos(points[startPt], points[smallestAngle]))
+		if (!startNeg && !dxPos(points, startPt, smallestAngle))
 			startNeg = true;
 		// Check if the hull has ended
-		if (points[smallestAngle]->x == points[leftPt]->x &&
-				points[smallestAngle]->y == points[leftPt]->y) {
+		if (points.x[smallestAngle] == points.x[leftPt] &&
+				points.y[smallestAngle] == points.y[leftPt]) {
 					return;
 		}
 		// Make the start point the point we just added
@@ -107,6 +118,16 @@ void DoGiftWrap(vector<Tuple*> points, ConvexHullApp *app)
 	}
 }
 
+/** Runs gift wrapping on a PointSet copy of the points and draws the
+ * resulting hull.
+ */
+void DoGiftWrap(vector<Tuple*> points, ConvexHullApp *app)
+{
+	vector<int> hull;
+	giftWrap(PointSet(points), hull);
+	addToHull(points, hull, app);
+}
+
 /**Check if a point is already on the hull, given the point to check
  * and the vector of indices on the hull.
  */
@@ -120,20 +141,123 @@ bool checkOnHull(int pt, vector<int> hull) {
 /** Checks if going from the start point to the next point makes moving
  * in the positive (true) or negative (false) x direction.
  */
-bool dxPos(Tuple *start, Tuple *next) {
-	double dx = (double) (next->x - start->x);
+bool dxPos(const PointSet &points, int start, int next) {
+	double dx = (double) (points.x[next] - points.x[start]);
 	return dx >= 0;
 }
 
-/** Finds the left-most point in the set of points to start off the 
- * hull.
+/** The smallest of the n values.
+ *
+ * With SSE2 this keeps four running minimums, one per lane, and only
+ * combines them at the end; either way the loop reads the array front to
+ * back, so it runs at memory speed.
+ */
+static int32_t minOf(const int32_t *v, size_t n) {
+	int32_t best = INT32_MAX;
+	size_t i = 0;
+#ifdef __SSE2__
+	if (n >= 4) {
+		__m128i m = _mm_loadu_si128((const __m128i *) v);
+		for (i = 4; i + 4 <= n; i += 4) {
+			__m128i a = _mm_loadu_si128((const __m128i *) (v + i));
+			// SSE2 has no 32-bit min, so select with a compare
+			__m128i less = _mm_cmplt_epi32(a, m);
+			m = _mm_or_si128(_mm_and_si128(less, a), _mm_andnot_si128(less, m));
+		}
+		int32_t lanes[4];
+		_mm_storeu_si128((__m128i *) lanes, m);
+		for (int k = 0; k < 4; k++)
+			if (lanes[k] < best) best = lanes[k];
+	}
+#endif
+	for (; i < n; i++)
+		if (v[i] < best) best = v[i];
+	return best;
+}
+
+/** The largest of the n values, the same way as minOf.
+ */
+static int32_t maxOf(const int32_t *v, size_t n) {
+	int32_t best = INT32_MIN;
+	size_t i = 0;
+#ifdef __SSE2__
+	if (n >= 4) {
+		__m128i m = _mm_loadu_si128((const __m128i *) v);
+		for (i = 4; i + 4 <= n; i += 4) {
+			__m128i a = _mm_loadu_si128((const __m128i *) (v + i));
+			__m128i greater = _mm_cmpgt_epi32(a, m);
+			m = _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, m));
+		}
+		int32_t lanes[4];
+		_mm_storeu_si128((__m128i *) lanes, m);
+		for (int k = 0; k < 4; k++)
+			if (lanes[k] > best) best = lanes[k];
+	}
+#endif
+	for (; i < n; i++)
+		if (v[i] > best) best = v[i];
+	return best;
+}
+
+/** The smallest of the values v[i] for which key[i] == k, or INT32_MAX if
+ * there are none.
+ */
+static int32_t minWhere(const int32_t *v, const int32_t *key, int32_t k,
+	size_t n) {
+	int32_t best = INT32_MAX;
+	size_t i = 0;
+#ifdef __SSE2__
+	if (n >= 4) {
+		__m128i m = _mm_set1_epi32(INT32_MAX);
+		__m128i kk = _mm_set1_epi32(k);
+		for (; i + 4 <= n; i += 4) {
+			__m128i a = _mm_loadu_si128((const __m128i *) (v + i));
+			__m128i match = _mm_cmpeq_epi32(
+				_mm_loadu_si128((const __m128i *) (key + i)), kk);
+			__m128i less = _mm_and_si128(match, _mm_cmplt_epi32(a, m));
+			m = _mm_or_si128(_mm_and_si128(less, a), _mm_andnot_si128(less, m));
+		}
+		int32_t lanes[4];
+		_mm_storeu_si128((__m128i *) lanes, m);
+		for (int j = 0; j < 4; j++)
+			if (lanes[j] < best) best = lanes[j];
+	}
+#endif
+	for (; i < n; i++)
+		if (key[i] == k && v[i] < best) best = v[i];
+	return best;
+}
+
+/** The first index i with a[i] == va and b[i] == vb, or n if there is
+ * none. With SSE2 four indices are checked at a time.
  */
-int leftMost(vector<Tuple*> points) {
-	int leftx = 0;
-	for (unsigned int i = 1; i < points.size(); i++) {
-		if (points[i]->x < points[leftx]->x) leftx = i;
+static size_t firstMatch(const int32_t *a, int32_t va, const int32_t *b,
+	int32_t vb, size_t n) {
+	size_t i = 0;
+#ifdef __SSE2__
+	__m128i aa = _mm_set1_epi32(va), bb = _mm_set1_epi32(vb);
+	for (; i + 4 <= n; i += 4) {
+		__m128i match = _mm_and_si128(
+			_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) (a + i)), aa),
+			_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *) (b + i)), bb));
+		if (_mm_movemask_epi8(match) != 0) break;
 	}
-	return leftx;
+#endif
+	for (; i < n; i++)
+		if (a[i] == va && b[i] == vb) return i;
+	return n;
+}
+
+/** Finds the left-most point in the set of points to start off the 
+ * hull: the first one with the smallest x-coordinate. Done as a SIMD
+ * min-reduction over the x-coordinates, then a search for where the
+ * minimum is.
+ */
+int leftMost(const PointSet &points) {
+	size_t n = points.size();
+	if (n == 0) return 0;
+	int32_t leftx = minOf(&points.x[0], n);
+	return firstMatch(&points.x[0], leftx, &points.x[0], leftx, n);
 }
 
 /** Finds the angle between two points, looking at the angle from the 
@@ -141,10 +265,10 @@ int leftMost(vector<Tuple*> points) {
  * axis the point is in, an amount is added, making sure the angle goes
  * from 0 to 2pi degrees.
  */
-double angle(Tuple* start, Tuple*next) {
+double angle(const PointSet &points, int start, int next) {
 	// Finds the dx and dy corresponding to these two points
-	double dx = (double) (next->x - start->x);
-	double dy = (double) (next->y - start->y);
+	double dx = (double) (points.x[next] - points.x[start]);
+	double dy = (double) (points.y[next] - points.y[start]);
 	
 	// If it is the same point, then consider the angle as being really
 	// large so it is not considered as a small angle
@@ -182,49 +306,61 @@ double angle(Tuple* start, Tuple*next) {
  *    the hull until there is a left turn again, and move on to the 
  *    next point to try.
  * 5. Stop when the last point added is the starting point
+ * The hull is given as indices into points, ending with the lowest point
+ * again.
  */
-void DoGrahamScan(vector<Tuple*> points, ConvexHullApp *app)
+void grahamScan(const PointSet &points, vector<int> &hull)
 {
+	hull.clear();
+	if (points.size() == 0) return;
 	// Start with the lowest point which will be on the hull
-	int lowIndex = lowestPt(points);
-	Tuple *lowest = points[lowIndex];
-	// We don't want to consider this point anymore
-	points.erase(points.begin() + lowIndex);
-	vector<Tuple*> onHull;
+	int lowest = lowestPt(points);
+	// Find the angle that each other point makes with the lowest point,
+	// and sort the points in ascending angle order
+	vector<AngleIndex> byAngle;
+	byAngle.reserve(points.size() - 1);
+	for (unsigned int i = 0; i < points.size(); i++) {
+		if ((int) i != lowest)
+			byAngle.push_back(AngleIndex(points.angle_wrt_pt(i, lowest), i));
+	}
+	sortlib::introsort(byAngle.begin(), byAngle.end(),
+		[](const AngleIndex &p) { return p.angle; });
+	vector<int> order(byAngle.size());
+	for (unsigned int i = 0; i < order.size(); i++)
+		order[i] = byAngle[i].index;
+	vector<int> &onHull = hull;
 	onHull.push_back(lowest);
-	// Find the angle that each point makes with the lowest point, and
-	// sort the points in ascending angle order
-	vector<double> angles;
-	for (unsigned int i = 0; i < points.size(); i++)
-		angles.push_back(points[i]->angle_wrt_pt(lowest));
-	sort(points, angles, 0, points.size() - 1);
-	onHull.push_back(points[0]);
+	if (order.empty()) {
+		onHull.push_back(lowest);
+		return;
+	}
+	onHull.push_back(order[0]);
+	int last = order[order.size() - 1];
 	// To go through the hull, use indices indexH to iterate through
 	// the points on the hull, and indexP to iterate through all of
 	// the points
 	int indexH = 2;
 	unsigned int indexP = 1;
-	while(indexP < points.size()) {
+	while(indexP < order.size()) {
 		// If there is a right turn, we must take out the second to last
 		// point added
-		while (indexP < points.size() && indexH >=2 && rightTurn(onHull[indexH-2], onHull[indexH-1], points[indexP])){
+		while (indexP < order.size() && indexH >=2 && rightTurn(points, onHull[indexH-2], onHull[indexH-1], order[indexP])){
 			onHull.pop_back();
-			onHull.push_back(points[indexP]);
+			onHull.push_back(order[indexP]);
 			indexH--;
 			// If there are still right turns, more backtracking is necessary
-			while (rightTurn(onHull[indexH-2], onHull[indexH - 1], onHull[indexH])) {
+			while (rightTurn(points, onHull[indexH-2], onHull[indexH - 1], onHull[indexH])) {
 				indexH--;
-				Tuple *top = onHull[onHull.size()-1];
+				int top = onHull[onHull.size()-1];
 				onHull.pop_back();
 				onHull.pop_back();
 				onHull.push_back(top);
 			}
 			// Check if the last point on the hull is the one with
-			// the largest angle, in which case we are done, and can 
-			// add all the points to the hull on the GUI
-			if (onHull[onHull.size() - 1]->x == points[points.size() - 1]->x
-			&& onHull[onHull.size() - 1]->y == points[points.size() - 1]->y) {
-				addToHull(onHull, lowest, app);
+			// the largest angle, in which case we are done
+			if (points.x[onHull[onHull.size() - 1]] == points.x[last]
+			&& points.y[onHull[onHull.size() - 1]] == points.y[last]) {
+				onHull.push_back(lowest);
 				return;
 			}
 			// Reset indexH to the number of points on the hull
@@ -232,83 +368,322 @@ void DoGrahamScan(vector<Tuple*> points, ConvexHullApp *app)
 			indexP++;
 		}
 		// Add a point to the hull if it causes a left turn
-		if (points[indexP] != onHull[onHull.size() - 1]) onHull.push_back(points[indexP]);
-		// Check again if we are done with the hull, and draw it if done
-		if (points[indexP]->x == points[points.size() - 1]->x
-		&& points[indexP]->y == points[points.size() - 1]->y) {
-			addToHull(onHull, lowest, app);
+		if (order[indexP] != onHull[onHull.size() - 1]) onHull.push_back(order[indexP]);
+		// Check again if we are done with the hull
+		if (points.x[order[indexP]] == points.x[last]
+		&& points.y[order[indexP]] == points.y[last]) {
+			onHull.push_back(lowest);
 			return;
 		}
 		indexH++;
 		indexP ++;
 	}
-	// At the end, if all points have been checked, draw it
-	addToHull(onHull, lowest, app);
+	// At the end, if all points have been checked, close the hull
+	onHull.push_back(lowest);
+}
+
+/** Runs Graham scan on a PointSet copy of the points and draws the
+ * resulting hull.
+ */
+void DoGrahamScan(vector<Tuple*> points, ConvexHullApp *app)
+{
+	vector<int> hull;
+	grahamScan(PointSet(points), hull);
+	addToHull(points, hull, app);
 }
 
 /** Find the lowest point in a set of points. If the lowest points
  * share the same y-coordinate, then the one with the lower x-coordinate
- * is used.
+ * is used, and if there are several of those, the first. ("Lowest" is on
+ * the screen, where y grows downwards, so this is the largest y.)
+ * Done as SIMD reductions: the largest y, then the smallest x among the
+ * points with that y, then a search for the first such point.
  */
-int lowestPt(vector<Tuple*> &points) {
-	int lowy = 0;
-	for (unsigned int i = 1; i < points.size(); i++) {
-		if (points[i]->y > points[lowy]->y) lowy = i;
-		else if (points[i]->y == points[lowy]->y) {
-			if (points[i]->x < points[lowy]->x)
-				lowy = i;
-		}
-	}
-	return lowy;
-} 
+int lowestPt(const PointSet &points) {
+	size_t n = points.size();
+	if (n == 0) return 0;
+	int32_t lowy = maxOf(&points.y[0], n);
+	int32_t lowx = minWhere(&points.x[0], &points.y[0], lowy, n);
+	return firstMatch(&points.y[0], lowy, &points.x[0], lowx, n);
+}
+
+/** Check if the three points of the set create a right turn, using the
+ * cross product.
+ */
+bool rightTurn(const PointSet &points, int Pt1, int Pt2, int Pt3) {
+	long long zCoord = (long long) (points.x[Pt2] - points.x[Pt1]) * (points.y[Pt3] - points.y[Pt1])
+		- (long long) (points.y[Pt2] - points.y[Pt1]) * (points.x[Pt3] - points.x[Pt1]);
+	return zCoord > 0;
+}
 
 /** Check if the three points create a right turn, using the cross
  * product.
  */
 bool rightTurn(Tuple *Pt1, Tuple *Pt2, Tuple *Pt3) {	
-	int zCoord = (Pt2->x- Pt1->x)*(Pt3->y-Pt1->y) - (Pt2->y-Pt1->y)*(Pt3->x-Pt1->x);
-	return zCoord > 0;
+	return crossProduct(Pt1, Pt2, Pt3) > 0;
+}
+
+/** The z-coordinate of the cross product of Pt1->Pt2 and Pt1->Pt3:
+ * positive for a right turn (as drawn on the screen), negative for a left
+ * turn and zero if the points are collinear. Worked out in 64 bits, so it
+ * is exact as long as the coordinates are within +/-2^30.
+ */
+long long crossProduct(Tuple *Pt1, Tuple *Pt2, Tuple *Pt3) {
+	return (long long) (Pt2->x - Pt1->x) * (Pt3->y - Pt1->y)
+		- (long long) (Pt2->y - Pt1->y) * (Pt3->x - Pt1->x);
 }
 
-/** Swap two points and their corresponding angles as part of the
- * quick sort in place algorithm
+/**
+ * Steps to Andrew's monotone chain
+ * 1. Sort the points by x-coordinate, breaking ties by y-coordinate,
+ *    and drop repeated points.
+ * 2. Build the lower hull: go through the points from left to right,
+ *    adding each to the chain. While the last three points on the chain
+ *    do not make a right turn, take out the middle one.
+ * 3. Build the upper hull the same way, going from right to left.
+ * 4. The hull is the lower hull followed by the upper hull, without
+ *    repeating the two end points they share.
+ * Only the integer cross product in rightTurn is used, so there is no
+ * rounding anywhere, and it takes O(n log n) time for the sort plus O(n)
+ * for the two passes.
+ */
+vector<Tuple*> monotoneChain(vector<Tuple*> points)
+{
+	vector<Tuple*> hull;
+	if (points.empty()) return hull;
+	sortByXY(&points[0], points.size());
+	// Sorted, repeated points are next to each other; without them, any
+	// number of copies of one point is a one-point hull
+	points.erase(std::unique(points.begin(), points.end(),
+		[](const Tuple *a, const Tuple *b) {
+			return a->x == b->x && a->y == b->y;
+		}), points.end());
+	hull.resize(2 * points.size());
+	hull.resize(chainSorted(&points[0], points.size(), &hull[0]));
+	return hull;
+}
+
+/** Sorts the n points by x-coordinate, breaking ties by y-coordinate.
+ */
+void sortByXY(Tuple **points, int n)
+{
+	sortlib::introsort(points, points + n, sortlib::Identity(),
+		[](const Tuple *a, const Tuple *b) {
+			return a->x < b->x || (a->x == b->x && a->y < b->y);
+		});
+}
+
+/** Steps 2 to 4 of monotone chain, on n >= 1 points already sorted by
+ * sortByXY. The hull goes into hull, which must have room for 2n points,
+ * and its size is returned. Repeated points are dropped, as they would be
+ * by the turn tests with three or more points.
+ */
+int chainSorted(Tuple **points, int n, Tuple **hull)
+{
+	if (n < 3) {
+		int k = 0;
+		for (int i = 0; i < n; i++) {
+			if (k > 0 && hull[k-1]->x == points[i]->x && hull[k-1]->y == points[i]->y)
+				continue;
+			hull[k++] = points[i];
+		}
+		return k;
+	}
+	int k = 0;
+	// Lower hull, left to right
+	for (int i = 0; i < n; i++) {
+		while (k >= 2 && !rightTurn(hull[k-2], hull[k-1], points[i])) k--;
+		hull[k++] = points[i];
+	}
+	// Upper hull, right to left; never pop into the lower hull
+	int lowerSize = k + 1;
+	for (int i = n - 2; i >= 0; i--) {
+		while (k >= lowerSize && !rightTurn(hull[k-2], hull[k-1], points[i])) k--;
+		hull[k++] = points[i];
+	}
+	// The last point is the first one again
+	return k - 1;
+}
+
+/** Runs the monotone chain algorithm and draws the resulting hull,
+ * closing it by going back to the first point.
+ */
+void DoMonotoneChain(vector<Tuple*> points, ConvexHullApp *app)
+{
+	vector<Tuple*> hull = monotoneChain(points);
+	if (hull.empty()) return;
+	for (unsigned int i = 0; i < hull.size(); i++)
+		app->add_to_hull(hull[i]);
+	app->add_to_hull(hull[0]);
+}
+
+/** The squared distance between two points.
+ */
+long long distSquared(Tuple *Pt1, Tuple *Pt2) {
+	long long dx = Pt2->x - Pt1->x, dy = Pt2->y - Pt1->y;
+	return dx * dx + dy * dy;
+}
+
+/** Checks if going from p, candidate r is a better next hull point than
+ * q, walking the hull in the same direction as monotoneChain: r is on the
+ * outer side of the line p->q, or is on it and further away. A candidate
+ * that is p itself is never better.
  */
-void swap(vector<Tuple*> &points, vector<double> &angles, int i, int j) {
-	// Switch the elements at the indices of angles
-	double temp1 = angles[i];
-	angles[i] = angles[j];
-	angles[j] = temp1;
+bool betterWrap(Tuple *p, Tuple *q, Tuple *r) {
+	if (r->x == p->x && r->y == p->y) return false;
+	if (q->x == p->x && q->y == p->y) return true;
+	long long z = crossProduct(p, q, r);
+	return z < 0 || (z == 0 && distSquared(p, r) > distSquared(p, q));
+}
 
-	// Switch the elements at the indices of points
-	Tuple* temp2 = points[i];
-	points[i] = points[j];
-	points[j] = temp2;
+/** Finds the point of the convex polygon hull[0, k) (as found by
+ * chainSorted) that gift wrapping would go to next from p: the one with
+ * the whole polygon on the same side as the rest of the hull.
+ *
+ * Uses a binary search, since going around the polygon the points first
+ * turn one way as seen from p and then the other. If p is on the polygon
+ * the search can be thrown off, so its answer is checked, and if it is
+ * wrong the points are gone through one by one instead. Small polygons
+ * are always gone through one by one, which is faster for them.
+ */
+int tangent(Tuple **hull, int k, Tuple *p) {
+	if (k >= TANGENT_SEARCH_MIN) {
+		// above(i, j): hull[j] is on the inner side of the line from p
+		// through hull[i]; below(i, j): on the outer side
+		#define above(i, j) (crossProduct(p, hull[(i) % k], hull[(j) % k]) > 0)
+		#define below(i, j) (crossProduct(p, hull[(i) % k], hull[(j) % k]) < 0)
+		int found = -1;
+		// Is hull[0] itself the answer?
+		if (below(1, 0) && !above(k - 1, 0)) found = 0;
+		int a = 0, b = k;
+		while (found < 0 && b - a > 1) {
+			int c = (a + b) / 2;
+			bool downC = below(c + 1, c);
+			if (downC && !above(c - 1, c)) {
+				found = c;
+				break;
+			}
+			// Keep the half of [a, b] that still has the answer in it
+			if (above(a + 1, a)) {
+				if (downC || above(a, c)) b = c;
+				else a = c;
+			}
+			else {
+				if (downC && below(a, c)) b = c;
+				else a = c;
+			}
+		}
+		#undef above
+		#undef below
+		// The answer has both of its neighbours on the same side
+		if (found >= 0 && !(hull[found]->x == p->x && hull[found]->y == p->y)
+			&& crossProduct(p, hull[found], hull[(found + 1) % k]) >= 0
+			&& crossProduct(p, hull[found], hull[(found + k - 1) % k]) >= 0) {
+			// A next point on the same line is further along the hull
+			int next = (found + 1) % k;
+			if (crossProduct(p, hull[found], hull[next]) == 0
+				&& distSquared(p, hull[next]) > distSquared(p, hull[found]))
+				found = next;
+			return found;
+		}
+	}
+	int best = 0;
+	for (int i = 1; i < k; i++)
+		if (betterWrap(p, hull[best], hull[i])) best = i;
+	return best;
 }
 
-/** Use quick sort in place to sort all the points by their angles.
+/**
+ * Steps to Chan's algorithm
+ * 1. Guess that the hull has at most m points.
+ * 2. Split the points into groups of m, and find the hull of each group
+ *    with monotone chain. This takes O(n log m) time.
+ * 3. Gift wrap around all the points, starting from the lowest-x point.
+ *    The next point from p is the best of each group's tangent from p,
+ *    which a binary search finds in O(log m) time, so each step takes
+ *    O((n/m) log m) time.
+ * 4. If the hull has not closed after m steps, the guess was too small:
+ *    square m and start again.
+ * Since m goes up so fast, the total time is O(n log h), which for a few
+ * dozen hull points out of millions is much less than O(n log n).
+ *
+ * The groups are sorted in place, and all of their hulls are kept in one
+ * array, so there is no allocation per group.
  */
-void sort(vector<Tuple*> &points, vector<double> &angles, int left, int right)
+vector<Tuple*> chanHull(vector<Tuple*> points)
 {
-	// End recursion when the list is only one element long
-	if (left >= right) return;
-	// The pivot is the middle point
-	double pivot = angles[(left + right)/2];
-	int i = left, j = right;
-	while (i <= j) {
-		// Goes through and finds points that are not on the side of
-		// the pivot they should be on, and swaps them if it can
-		while (angles[i] < pivot) i++;
-		while (angles[j] > pivot) j--;
-		if (i <= j) {
-			swap(points, angles, i, j);
-			i++;
-			j--;
+	vector<Tuple*> hull;
+	int n = points.size();
+	if (n < 3) return monotoneChain(points);
+	vector<Tuple*> groupHulls(n), scratch;
+	vector<int> start, size;
+	// m = 2^(2^t) for t = 2, 3, ...; hulls of up to 4 points would be
+	// found with m = 4, but that pass costs about as much as the next one
+	for (unsigned int t = 2; ; t++) {
+		int m = (t >= 5) ? n : std::min(n, 1 << (1 << t));
+		scratch.resize(2 * m);
+		// Hulls of each group of m points, one after another
+		start.clear();
+		size.clear();
+		int used = 0;
+		for (int first = 0; first < n; first += m) {
+			int count = std::min(n - first, m);
+			sortByXY(&points[first], count);
+			int k = chainSorted(&points[first], count, &scratch[0]);
+			std::copy(scratch.begin(), scratch.begin() + k, groupHulls.begin() + used);
+			start.push_back(used);
+			size.push_back(k);
+			used += k;
 		}
+		int groups = start.size();
+		// Every group's hull starts at its lowest-x point; start with the
+		// lowest of those
+		int g = 0;
+		for (int i = 1; i < groups; i++) {
+			Tuple *a = groupHulls[start[i]], *b = groupHulls[start[g]];
+			if (a->x < b->x || (a->x == b->x && a->y < b->y)) g = i;
+		}
+		Tuple *first = groupHulls[start[g]];
+		int j = 0;
+		hull.clear();
+		hull.push_back(first);
+		bool closed = false;
+		for (int step = 0; step < m; step++) {
+			Tuple *p = groupHulls[start[g] + j];
+			// The next point in p's own group is where its hull goes
+			int bestG = g, bestJ = (j + 1) % size[g];
+			Tuple *best = groupHulls[start[g] + bestJ];
+			for (int i = 0; i < groups; i++) {
+				if (i == g) continue;
+				int k = tangent(&groupHulls[start[i]], size[i], p);
+				if (betterWrap(p, best, groupHulls[start[i] + k])) {
+					bestG = i;
+					bestJ = k;
+					best = groupHulls[start[i] + k];
+				}
+			}
+			g = bestG;
+			j = bestJ;
+			if (best->x == first->x && best->y == first->y) {
+				closed = true;
+				break;
+			}
+			hull.push_back(best);
+		}
+		if (closed || m >= n) return hull;
 	}
-	// Recursiely call quicksort on these two lists.
-	if (left < j) sort(points, angles, left, j);
-	if (i < right) sort(points, angles, i, right);
-    return;
+}
+
+/** Runs Chan's algorithm and draws the resulting hull, closing it by
+ * going back to the first point.
+ */
+void DoChan(vector<Tuple*> points, ConvexHullApp *app)
+{
+	vector<Tuple*> hull = chanHull(points);
+	if (hull.empty()) return;
+	for (unsigned int i = 0; i < hull.size(); i++)
+		app->add_to_hull(hull[i]);
+	app->add_to_hull(hull[0]);
 }
 
 /** Prints the points on the hull for debugging purposes
@@ -321,11 +696,10 @@ void printHull(vector<Tuple*> hull) {
 	std::cout << std::endl;
 }
 
-/** Adds all the points to the ConvexHullApp for the GUI when the hull
- *is ended
+/** Adds the points with the given indices to the ConvexHullApp for the
+ * GUI, in order, once the hull is done
  */
-void addToHull(vector<Tuple*> hull, Tuple *lowest, ConvexHullApp *app) {
+void addToHull(vector<Tuple*> &points, vector<int> &hull, ConvexHullApp *app) {
 	for (unsigned int i = 0; i < hull.size(); i++)
-		app->add_to_hull(hull[i]);
-	app->add_to_hull(lowest);
+		app->add_to_hull(points[hull[i]]);
 }
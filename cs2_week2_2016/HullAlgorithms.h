@@ -15,21 +15,58 @@
 #include <cstdlib>
 #include <stdlib.h>
 #include <iostream>
-#include "ConvexHullApp.h"
 #include "structs.h"
+#include "sortlib.h"
 #include <math.h>
+#include <stdint.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 using namespace std;
 
+#ifndef HEADLESS
+#include "ConvexHullApp.h"
+#else
+/**
+ * @brief Stand-in for the SDL application in headless builds (-DHEADLESS).
+ *
+ * The hull algorithms report their result through add_to_hull as usual;
+ * this version just collects the points instead of animating them.
+ */
+class ConvexHullApp
+{
+public:
+    void add_to_hull(Tuple *p) { hull.push_back(p); }
+    void delete_hull() { hull.clear(); }
+
+    /**
+     * @brief The points constituting the hull
+     */
+    vector<Tuple*> hull;
+};
+#endif
+
+void giftWrap(const PointSet &points, vector<int> &hull);
 void DoGiftWrap(vector<Tuple*> points, ConvexHullApp *app);
-int leftMost(vector<Tuple*> points);
+int leftMost(const PointSet &points);
 bool checkOnHull(int pt, vector<int> hull);
-bool dxPos(Tuple *start, Tuple *next);
-double angle(Tuple* start, Tuple *next);
+bool dxPos(const PointSet &points, int start, int next);
+double angle(const PointSet &points, int start, int next);
+void grahamScan(const PointSet &points, vector<int> &hull);
 void DoGrahamScan(vector<Tuple*> points, ConvexHullApp *app);
-void swap(vector<Tuple*> &points, vector<double> &angles, int i, int j);
-void sort(vector<Tuple*> &points, vector<double> &angles, int left, int right);
-int lowestPt(vector<Tuple*> &points);
+int lowestPt(const PointSet &points);
+bool rightTurn(const PointSet &points, int Pt1, int Pt2, int Pt3);
 bool rightTurn(Tuple *Pt1, Tuple *Pt2, Tuple *Pt3);
+long long crossProduct(Tuple *Pt1, Tuple *Pt2, Tuple *Pt3);
+vector<Tuple*> monotoneChain(vector<Tuple*> points);
+void sortByXY(Tuple **points, int n);
+int chainSorted(Tuple **points, int n, Tuple **hull);
+void DoMonotoneChain(vector<Tuple*> points, ConvexHullApp *app);
+long long distSquared(Tuple *Pt1, Tuple *Pt2);
+bool betterWrap(Tuple *p, Tuple *q, Tuple *r);
+int tangent(Tuple **hull, int k, Tuple *p);
+vector<Tuple*> chanHull(vector<Tuple*> points);
+void DoChan(vector<Tuple*> points, ConvexHullApp *app);
 void printHull(vector<Tuple*> hull);
-void addToHull(vector<Tuple*> hull, Tuple *lowest, ConvexHullApp *app);
+void addToHull(vector<Tuple*> &points, vector<int> &hull, ConvexHullApp *app);
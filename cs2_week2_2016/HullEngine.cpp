@@ -0,0 +1,314 @@
+/**
+ * @file
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief A headless convex hull engine for large point sets
+ * (implementation).
+ *
+ */
+#include <thread>
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include "HullEngine.h"
+#include "sortlib.h"
+
+/**
+ * @brief Number of directions the filter looks for extreme points in.
+ */
+#define FILTER_DIRECTIONS 8
+
+/**
+ * @brief Indices of the points furthest in each of the filter's
+ * directions: -x, -x-y, -y, x-y, x, x+y, y, -x+y. That is
+ * counterclockwise (with y pointing up), so the points come out in order
+ * around the hull.
+ */
+struct Extremes
+{
+	int index[FILTER_DIRECTIONS];
+};
+
+/**
+ * Twice the signed area of the triangle a, b, c: positive if they turn
+ * counterclockwise (with y pointing up), zero if they are collinear.
+ * Exact as long as every coordinate is within +/-2^30.
+ */
+static inline long long cross(const Tuple &a, const Tuple &b, const Tuple &c)
+{
+	return (long long) (b.x - a.x) * (c.y - a.y)
+		- (long long) (b.y - a.y) * (c.x - a.x);
+}
+
+/**
+ * How far p is in direction d of the filter.
+ */
+static inline long long extent(const Tuple &p, int d)
+{
+	long long x = p.x, y = p.y;
+	switch (d) {
+		case 0: return -x;
+		case 1: return -x - y;
+		case 2: return -y;
+		case 3: return x - y;
+		case 4: return x;
+		case 5: return x + y;
+		case 6: return y;
+		default: return y - x;
+	}
+}
+
+/**
+ * Finds the extreme points of points[begin, end).
+ */
+static void findExtremes(const Tuple *points, size_t begin, size_t end,
+	Extremes *out)
+{
+	long long best[FILTER_DIRECTIONS];
+	for (int d = 0; d < FILTER_DIRECTIONS; d++) {
+		out->index[d] = begin;
+		best[d] = extent(points[begin], d);
+	}
+	for (size_t i = begin + 1; i < end; i++) {
+		long long x = points[i].x, y = points[i].y;
+		long long v[FILTER_DIRECTIONS] = { -x, -x - y, -y, x - y, x, x + y, y, y - x };
+		for (int d = 0; d < FILTER_DIRECTIONS; d++) {
+			if (v[d] > best[d]) {
+				best[d] = v[d];
+				out->index[d] = i;
+			}
+		}
+	}
+}
+
+/**
+ * Combines the extremes of two parts of the array.
+ */
+static void mergeExtremes(const Tuple *points, Extremes &e, const Extremes &f)
+{
+	for (int d = 0; d < FILTER_DIRECTIONS; d++) {
+		if (extent(points[f.index[d]], d) > extent(points[e.index[d]], d))
+			e.index[d] = f.index[d];
+	}
+}
+
+/**
+ * @brief The filter's polygon, as one line a x + b y + c = 0 per edge,
+ * with a x + b y + c > 0 on the inside.
+ *
+ * Unused edges repeat the first one, so that every point is tested against
+ * all FILTER_DIRECTIONS of them without branching.
+ */
+struct FilterPolygon
+{
+	long long a[FILTER_DIRECTIONS], b[FILTER_DIRECTIONS], c[FILTER_DIRECTIONS];
+	bool empty;
+};
+
+/**
+ * Builds the filter's polygon from the extremes, going counterclockwise
+ * and leaving out edges of length zero (when one point is extreme in more
+ * than one direction). With fewer than three corners it has no inside.
+ */
+static void buildPolygon(const Tuple *points, const Extremes &e,
+	FilterPolygon &polygon)
+{
+	const Tuple *corners[FILTER_DIRECTIONS];
+	int k = 0;
+	for (int d = 0; d < FILTER_DIRECTIONS; d++) {
+		const Tuple *p = &points[e.index[d]];
+		if (k > 0 && corners[k-1]->x == p->x && corners[k-1]->y == p->y) continue;
+		corners[k++] = p;
+	}
+	while (k > 1 && corners[k-1]->x == corners[0]->x && corners[k-1]->y == corners[0]->y) k--;
+	polygon.empty = (k < 3);
+	for (int i = 0; i < FILTER_DIRECTIONS; i++) {
+		// The line through corners p and q; a x + b y + c is cross(p, q, (x, y))
+		const Tuple &p = *corners[i < k ? i : 0];
+		const Tuple &q = *corners[i < k ? (i + 1) % k : 1 % k];
+		polygon.a[i] = -(long long) (q.y - p.y);
+		polygon.b[i] = (long long) (q.x - p.x);
+		polygon.c[i] = -(polygon.a[i] * p.x + polygon.b[i] * p.y);
+	}
+}
+
+/**
+ * Checks if p is strictly inside the filter's polygon.
+ */
+static inline bool insidePolygon(const FilterPolygon &polygon, const Tuple &p)
+{
+	bool inside = !polygon.empty;
+	for (int i = 0; i < FILTER_DIRECTIONS; i++)
+		inside &= (polygon.a[i] * p.x + polygon.b[i] * p.y + polygon.c[i] > 0);
+	return inside;
+}
+
+/**
+ * Takes the hull of the indices into points, with Andrew's monotone chain.
+ * indices gets sorted by (x, y); the hull goes into hull, counterclockwise
+ * from the first point in that order.
+ */
+void hullOfIndices(const Tuple *points, std::vector<int> &indices,
+	std::vector<int> &hull)
+{
+	hull.clear();
+	size_t n = indices.size();
+	// One 64-bit key orders by x, then y
+	sortlib::introsort(indices.begin(), indices.end(), [points](int i) {
+		return (long long) points[i].x * 4294967296LL
+			+ ((long long) points[i].y - INT32_MIN);
+	});
+	if (n < 3) {
+		// Sorted, so a repeated point follows its twin
+		for (size_t i = 0; i < n; i++) {
+			const Tuple &p = points[indices[i]];
+			if (hull.empty() || points[hull.back()].x != p.x
+				|| points[hull.back()].y != p.y) hull.push_back(indices[i]);
+		}
+		return;
+	}
+	hull.resize(2 * n);
+	size_t k = 0;
+	// Lower hull, left to right
+	for (size_t i = 0; i < n; i++) {
+		while (k >= 2 && cross(points[hull[k-2]], points[hull[k-1]],
+			points[indices[i]]) <= 0) k--;
+		hull[k++] = indices[i];
+	}
+	// Upper hull, right to left; never pop into the lower hull
+	size_t lowerSize = k + 1;
+	for (size_t i = n - 1; i-- > 0; ) {
+		while (k >= lowerSize && cross(points[hull[k-2]], points[hull[k-1]],
+			points[indices[i]]) <= 0) k--;
+		hull[k++] = indices[i];
+	}
+	// The last point is the first one again
+	hull.resize(k - 1);
+}
+
+/**
+ * The work done by each thread of HullEngine::compute: drops the points of
+ * points[begin, end) inside the filter's polygon and takes the hull of the
+ * rest.
+ */
+static void chunkHull(const Tuple *points, size_t begin, size_t end,
+	const FilterPolygon *polygon, std::vector<int> *hull, size_t *kept)
+{
+	std::vector<int> survivors;
+	for (size_t i = begin; i < end; i++) {
+		if (!insidePolygon(*polygon, points[i])) survivors.push_back(i);
+	}
+	*kept = survivors.size();
+	hullOfIndices(points, survivors, *hull);
+}
+
+/**
+ * @brief Makes an engine that uses up to nthreads threads, or one per core
+ * if nthreads is 0.
+ */
+HullEngine::HullEngine(int nthreads)
+{
+	if (nthreads < 1) nthreads = std::thread::hardware_concurrency();
+	if (nthreads < 1) nthreads = 1;
+	this->nthreads = nthreads;
+	last_survivors = 0;
+}
+
+/**
+ * @brief Computes the convex hull of points[0, n).
+ *
+ * @return the indices of the hull's vertices, in counterclockwise order.
+ */
+std::vector<int> HullEngine::compute(const Tuple *points, size_t n)
+{
+	std::vector<int> hull;
+	last_survivors = n;
+	if (n == 0) return hull;
+
+	// Give every thread at least HULL_PARALLEL_MIN points
+	size_t chunks = std::min((size_t) nthreads, n / HULL_PARALLEL_MIN);
+	if (chunks < 1) chunks = 1;
+	std::vector<size_t> bounds(chunks + 1);
+	for (size_t c = 0; c <= chunks; c++) bounds[c] = n * c / chunks;
+
+	// 1. The extremes of each chunk, then of the whole array
+	std::vector<Extremes> extremes(chunks);
+	std::vector<std::thread> workers;
+	for (size_t c = 1; c < chunks; c++) {
+		workers.push_back(std::thread(findExtremes, points, bounds[c],
+			bounds[c+1], &extremes[c]));
+	}
+	findExtremes(points, bounds[0], bounds[1], &extremes[0]);
+	for (unsigned int t = 0; t < workers.size(); t++) workers[t].join();
+	workers.clear();
+	Extremes e = extremes[0];
+	for (size_t c = 1; c < chunks; c++) mergeExtremes(points, e, extremes[c]);
+	FilterPolygon polygon;
+	buildPolygon(points, e, polygon);
+
+	// 2. Filter and take the hull of each chunk
+	std::vector<std::vector<int> > subHulls(chunks);
+	std::vector<size_t> kept(chunks);
+	for (size_t c = 1; c < chunks; c++) {
+		workers.push_back(std::thread(chunkHull, points, bounds[c],
+			bounds[c+1], &polygon, &subHulls[c], &kept[c]));
+	}
+	chunkHull(points, bounds[0], bounds[1], &polygon, &subHulls[0], &kept[0]);
+	for (unsigned int t = 0; t < workers.size(); t++) workers[t].join();
+
+	// 3. Merge: the hull of the sub-hulls is the hull of everything
+	if (chunks == 1) {
+		last_survivors = kept[0];
+		return subHulls[0];
+	}
+	std::vector<int> merged;
+	last_survivors = 0;
+	for (size_t c = 0; c < chunks; c++) {
+		last_survivors += kept[c];
+		merged.insert(merged.end(), subHulls[c].begin(), subHulls[c].end());
+	}
+	hullOfIndices(points, merged, hull);
+	return hull;
+}
+
+/**
+ * @brief Reads a file of "x y" lines into points.
+ *
+ * The whole file is read with one fread and parsed by hand, which is many
+ * times faster than fscanf on files of millions of points.
+ *
+ * @return `false` if the file cannot be opened.
+ */
+bool readPointFile(const char *filename, std::vector<Tuple> &points)
+{
+	FILE *f = fopen(filename, "rb");
+	if (f == NULL) return false;
+	std::vector<char> buffer;
+	char block[1 << 16];
+	size_t got;
+	while ((got = fread(block, 1, sizeof(block), f)) > 0)
+		buffer.insert(buffer.end(), block, block + got);
+	fclose(f);
+	buffer.push_back('\0');
+
+	const char *p = &buffer[0];
+	int values[2];
+	int count = 0;
+	while (true) {
+		// Skip to the next number
+		while (*p != '\0' && *p != '-' && (*p < '0' || *p > '9')) p++;
+		if (*p == '\0') break;
+		bool negative = (*p == '-');
+		if (negative) p++;
+		long long value = 0;
+		while (*p >= '0' && *p <= '9') value = value * 10 + (*p++ - '0');
+		values[count++] = (int) (negative ? -value : value);
+		if (count == 2) {
+			points.push_back(Tuple(values[0], values[1]));
+			count = 0;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief A headless convex hull engine for large point sets (header file).
+ *
+ */
+#ifndef __HULLENGINE_H__
+#define __HULLENGINE_H__
+
+#include <vector>
+#include <cstddef>
+#include "structs.h"
+
+/**
+ * @brief Chunks with fewer points than this are not worth a thread of
+ * their own.
+ */
+#ifndef HULL_PARALLEL_MIN
+#define HULL_PARALLEL_MIN (1 << 15)
+#endif
+
+/**
+ * @brief Computes convex hulls of contiguous point arrays, without SDL.
+ *
+ * compute() works in three steps:
+ * 1. Find the points furthest out in eight directions: the smallest and
+ *    largest x, y, x+y and x-y. They are on the hull, so nothing strictly
+ *    inside the polygon they form can be a hull vertex (the Akl-Toussaint
+ *    heuristic, with an octagon rather than the original quadrilateral,
+ *    which still lets half of a square through).
+ *    On random input this throws away nearly every point.
+ * 2. Split the array into one chunk per thread. Each thread drops its
+ *    chunk's interior points and takes the monotone chain hull of the rest.
+ * 3. Take the monotone chain hull of all of the sub-hulls' vertices.
+ *
+ * The hull comes back as indices into the array, counterclockwise (with y
+ * pointing up) from the point with the smallest x, and the smallest y among
+ * those. Points in the middle of a hull edge are left out.
+ */
+class HullEngine
+{
+public:
+    HullEngine(int nthreads = 0);
+
+    std::vector<int> compute(const Tuple *points, size_t n);
+
+    /**
+     * @brief How many points the last compute() call had left after the
+     * Akl-Toussaint filter.
+     */
+    size_t survivors() const { return last_survivors; }
+
+private:
+    int nthreads;
+    size_t last_survivors;
+};
+
+void hullOfIndices(const Tuple *points, std::vector<int> &indices,
+    std::vector<int> &hull);
+bool readPointFile(const char *filename, std::vector<Tuple> &points);
+
+#endif
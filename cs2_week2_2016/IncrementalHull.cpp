@@ -0,0 +1,149 @@
+/**
+ * @file
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief A convex hull that points can be added to one batch at a time
+ * (implementation).
+ *
+ */
+#include <iterator>
+#include "IncrementalHull.h"
+
+/**
+ * @brief Makes an empty half hull.
+ *
+ * @param upper: whether this is the upper half of the hull
+ */
+HalfHull::HalfHull(bool upper)
+{
+	this->upper = upper;
+}
+
+/**
+ * The cross product of a->b and a->(x, y): positive if the three points
+ * turn counterclockwise, which is what the lower hull does at every vertex.
+ */
+long long HalfHull::cross(Chain::const_iterator a, Chain::const_iterator b,
+	int x, long long y)
+{
+	return ((long long) b->first - a->first) * (y - a->second)
+		- (b->second - a->second) * ((long long) x - a->first);
+}
+
+/**
+ * @brief Adds the point (x, y) to this half of the hull.
+ *
+ * 1. If there is already a vertex with this x, keep whichever is lower.
+ * 2. Otherwise, if the point is on or above the segment between the
+ *    vertices either side of it, it is not on this half of the hull.
+ * 3. Otherwise add it, and take out the vertices next to it on either side
+ *    for as long as they stop being corners.
+ *
+ * @return `true` if the point became a vertex.
+ */
+bool HalfHull::insert(int x, int y)
+{
+	long long v = upper ? -(long long) y : y;
+	Chain::iterator next = vertices.lower_bound(x);
+	if (next != vertices.end() && next->first == x) {
+		if (next->second <= v) return false;
+		next = vertices.erase(next);
+	}
+	else if (next != vertices.end() && next != vertices.begin()) {
+		if (cross(std::prev(next), next, x, v) >= 0) return false;
+	}
+	Chain::iterator added = vertices.insert(next, Chain::value_type(x, v));
+
+	// Vertices to the left that no longer turn counterclockwise
+	while (added != vertices.begin()) {
+		Chain::iterator b = std::prev(added);
+		if (b == vertices.begin()) break;
+		Chain::iterator a = std::prev(b);
+		if (cross(a, b, x, v) > 0) break;
+		vertices.erase(b);
+	}
+	// And to the right
+	while (true) {
+		Chain::iterator b = std::next(added);
+		if (b == vertices.end()) break;
+		Chain::iterator c = std::next(b);
+		if (c == vertices.end()) break;
+		if (cross(added, b, c->first, c->second) > 0) break;
+		vertices.erase(b);
+	}
+	return true;
+}
+
+/**
+ * @brief Adds this half's vertices to out, left to right, or right to left
+ * if reverse is set.
+ */
+void HalfHull::append(std::vector<Tuple> &out, bool reverse) const
+{
+	int sign = upper ? -1 : 1;
+	if (reverse) {
+		for (Chain::const_reverse_iterator i = vertices.rbegin(); i != vertices.rend(); ++i)
+			out.push_back(Tuple(i->first, (int) (sign * i->second)));
+	}
+	else {
+		for (Chain::const_iterator i = vertices.begin(); i != vertices.end(); ++i)
+			out.push_back(Tuple(i->first, (int) (sign * i->second)));
+	}
+}
+
+/**
+ * @brief Makes an empty hull.
+ */
+IncrementalHull::IncrementalHull() : lower(false), upper(true)
+{
+	total = 0;
+}
+
+/**
+ * @brief Adds the n points to the hull.
+ *
+ * @return the number of points that became hull vertices (some of which
+ * may already have been hidden again by later points in the batch).
+ */
+size_t IncrementalHull::insert(const Tuple *points, size_t n)
+{
+	size_t added = 0;
+	for (size_t i = 0; i < n; i++) {
+		// Not ||: the point has to go into both halves
+		bool onLower = lower.insert(points[i].x, points[i].y);
+		bool onUpper = upper.insert(points[i].x, points[i].y);
+		if (onLower || onUpper) added++;
+	}
+	total += n;
+	return added;
+}
+
+/**
+ * @brief Returns the current hull, counterclockwise from the lowest-x
+ * point.
+ */
+std::vector<Tuple> IncrementalHull::snapshot() const
+{
+	std::vector<Tuple> hull, top;
+	lower.append(hull, false);
+	upper.append(top, true);
+	if (hull.empty()) return hull;
+	// The halves share their end points unless there are vertical edges
+	// at the ends
+	size_t first = 0, last = top.size();
+	if (top[0].y == hull.back().y) first++;
+	if (last > first && top[last - 1].y == hull[0].y) last--;
+	for (size_t i = first; i < last; i++) hull.push_back(top[i]);
+	return hull;
+}
+
+/**
+ * @brief Returns the number of vertices of the current hull. Takes O(h)
+ * time, since it has to work out which end points the halves share.
+ */
+size_t IncrementalHull::size() const
+{
+	return snapshot().size();
+}
@@ -0,0 +1,93 @@
+/**
+ * @file
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief A convex hull that points can be added to one batch at a time
+ * (header file).
+ *
+ */
+#ifndef __INCREMENTALHULL_H__
+#define __INCREMENTALHULL_H__
+
+#include <map>
+#include <vector>
+#include <cstddef>
+#include "structs.h"
+
+/**
+ * @brief One half of an IncrementalHull: the lower hull, or the upper hull
+ * stored upside down (with y negated) so that the same code keeps both.
+ *
+ * The vertices are kept in a map (a red-black tree) from x to y, so the
+ * neighbours of a new point are found in O(log h) time. Each point is
+ * inserted and removed at most once, so an insert takes amortized
+ * O(log h) time.
+ */
+class HalfHull
+{
+public:
+    HalfHull(bool upper);
+
+    bool insert(int x, int y);
+    void append(std::vector<Tuple> &out, bool reverse) const;
+
+    /**
+     * @brief Number of vertices on this half of the hull.
+     */
+    size_t size() const { return vertices.size(); }
+
+private:
+    typedef std::map<int, long long> Chain;
+
+    /**
+     * @brief true if this is the upper hull, whose y-coordinates are
+     * stored negated.
+     */
+    bool upper;
+
+    /**
+     * @brief The vertices from left to right, as x -> (maybe negated) y.
+     * y is kept in 64 bits so that negating INT_MIN is safe.
+     */
+    Chain vertices;
+
+    static long long cross(Chain::const_iterator a, Chain::const_iterator b,
+        int x, long long y);
+};
+
+/**
+ * @brief A convex hull that grows as points are added.
+ *
+ * Points are added in batches with insert(), and snapshot() returns the
+ * current hull at any time, in the same order as monotoneChain:
+ * counterclockwise (with y pointing up) from the point with the smallest
+ * x, and the smallest y among those. Points in the middle of a hull edge
+ * are left out. A point that falls inside the hull costs two O(log h)
+ * lookups, and so does adding a hull point, apart from removing the
+ * vertices it hides, which is paid for when they were added.
+ *
+ * Coordinates must be within +/-2^30 for the cross products to be exact.
+ */
+class IncrementalHull
+{
+public:
+    IncrementalHull();
+
+    size_t insert(const Tuple *points, size_t n);
+    std::vector<Tuple> snapshot() const;
+    size_t size() const;
+
+    /**
+     * @brief How many points have been inserted in all.
+     */
+    size_t inserted() const { return total; }
+
+private:
+    HalfHull lower;
+    HalfHull upper;
+    size_t total;
+};
+
+#endif
@@ -81,16 +81,21 @@ vector<Tuple> line(Tuple p1, Tuple p2)
 	p1 = switchToOctantZero(octantNum, p1.x, p1.y);
 	p2 = switchToOctantZero(octantNum, p2.x, p2.y);
 	
-	// Find the absolute value of the slope based on the new first octant version
-	double slope = abs((double)(p2.y - p1.y) / (double)(p2.x - p1.x));
+	// The x and y distances in the first octant. The slope is dy / dx,
+	// but rather than keep it as a double (which cannot hold values
+	// like 1/3 exactly, so that ties get rounded either way) all of the
+	// error terms below are multiplied by 2 * dx to keep them integers
+	int dx = p2.x - p1.x;
+	int dy = abs(p2.y - p1.y);
 	
 	// The error starts at the slope - 0.5 (The error always ranges from -0.5 to 0.5)
 	// Since slope is between 0 and 0.5, the error will start out in the bottom
 	// half of this range
-	double error = slope - 0.5;
+	long long error = 2LL * dy - dx;
 	// Start out with point p1
 	int yPt = p1.y;
 	int xPt = p1.x;
+	plot.reserve(dx + 1);
 	// Go through all the x coordinates from p1 to p2
 	while (xPt <= p2.x) {
 		// Plot the corrected octant point that is part of the line
@@ -99,13 +104,13 @@ vector<Tuple> line(Tuple p1, Tuple p2)
 		// Add the slope (extra y distance) from going 1 unit to the right
 		// to the error that is accumulating for y direction (we can only
 		// plot integer y coordinates so can't plot slope directly)
-		error += slope;
+		error += 2 * dy;
 		// If the error is past the maximum, increment the y coordinate
 		// to move the line up (in the first octant), and adjust the error
 		// to account for this amount being taken care of
-		if (error >= 0.5) {
+		if (error >= dx) {
 			yPt ++;
-			error --;
+			error -= 2 * dx;
 		}
 		// Move to next x coordinate between p1 and p2
 		xPt ++;
@@ -203,3 +208,521 @@ Tuple switchFromOctantZero(int octant, int x, int y) {
 	}
 	return Tuple(x, y);
 }
+
+/** Where one step along the line (in x, in the first octant) and one
+ *  step across it (in y) go in each octant: switchFromOctantZero applied
+ *  to (1, 0) and (0, 1)
+ */
+static const int majorX[8] = { 1, 0, 0, -1, -1, 0, 0, 1 };
+static const int majorY[8] = { 0, 1, 1, 0, 0, -1, -1, 0 };
+static const int minorX[8] = { 0, 1, -1, 0, 0, -1, 1, 0 };
+static const int minorY[8] = { 1, 0, 0, 1, -1, 0, 0, -1 };
+
+/** The same octant as findOctant, from the x and y distances
+ */
+static inline int octantOf(int delX, int delY) {
+	bool steep = abs(delY) >= abs(delX);
+	if (delX < 0)
+		return delY > 0 ? (steep ? 2 : 3) : (steep ? 5 : 4);
+	return delY > 0 ? (steep ? 1 : 0) : (steep ? 6 : 7);
+}
+
+/** A segment seen from the first octant: which octant it was in, how
+ *  many steps it takes along the line (the first octant's dx) and how
+ *  many of those also step across it (dy)
+ */
+struct Walk {
+	int octant;
+	int length;
+	int rise;
+};
+
+static inline Walk walkOf(const Segment &s) {
+	Walk w;
+	int delX = s.x1 - s.x0;
+	int delY = s.y1 - s.y0;
+	w.octant = octantOf(delX, delY);
+	// Octants 0, 3, 4 and 7 step along x, the others along y
+	if (majorY[w.octant] == 0) {
+		w.length = abs(delX);
+		w.rise = abs(delY);
+	}
+	else {
+		w.length = abs(delY);
+		w.rise = abs(delX);
+	}
+	return w;
+}
+
+/** Whether every pixel of the segment is in the buffer
+ */
+static inline bool inside(const Segment &s, const PixelBuffer &buffer) {
+	return s.x0 >= 0 && s.x1 >= 0 && s.x0 < buffer.width && s.x1 < buffer.width
+		&& s.y0 >= 0 && s.y1 >= 0 && s.y0 < buffer.height && s.y1 < buffer.height;
+}
+
+/** How many times the walk has stepped across by its k-th pixel, in
+ *  closed form: floor(rise * (k + 1) / length), except on diagonals,
+ *  where it steps across every time
+ */
+static inline long long riseAt(const Walk &w, long long k) {
+	if (w.rise == w.length)
+		return k;
+	return w.rise * (k + 1) / w.length;
+}
+
+/** The first pixel of the walk that has stepped across at least m
+ *  times, or length + 1 if there is none
+ */
+static inline long long firstWithRise(const Walk &w, long long m) {
+	if (m <= 0)
+		return 0;
+	if (w.rise == 0 || m > w.rise)
+		return w.length + 1LL;
+	if (w.rise == w.length)
+		return m;
+	return (m * w.length + w.rise - 1) / w.rise - 1;
+}
+
+/** The last pixel of the walk that has stepped across at most m times,
+ *  or -1 if there is none
+ */
+static inline long long lastWithRise(const Walk &w, long long m) {
+	if (m < 0)
+		return -1;
+	if (w.rise == 0 || m >= w.rise)
+		return w.length;
+	if (w.rise == w.length)
+		return m;
+	return ((m + 1) * w.length - 1) / w.rise - 1;
+}
+
+/** The range of t for which start + sign * t is in [0, size)
+ */
+static inline void stepsInside(int start, int sign, int size, long long &lo,
+	long long &hi) {
+	if (sign > 0) {
+		lo = -(long long) start;
+		hi = (long long) size - 1 - start;
+	}
+	else {
+		lo = (long long) start - size + 1;
+		hi = start;
+	}
+}
+
+/** The same walk as line(), but with the error kept as an integer and
+ *  each step being a move of the pixel pointer: major along the line,
+ *  and minor as well whenever the error passes its maximum (chosen with
+ *  a mask rather than a branch, which would be mispredicted about as
+ *  often as not). Draws steps + 1 pixels, starting at p with the given
+ *  error, all of which must be in the buffer.
+ */
+static inline void drawInside(uint32_t *p, ptrdiff_t major, ptrdiff_t minor,
+	long long steps, int length, int rise, long long error, uint32_t color) {
+	for (long long i = 0; i < steps; i++) {
+		*p = color;
+		error += 2 * rise;
+		ptrdiff_t across = -(ptrdiff_t) (error >= length);
+		p += major + (minor & across);
+		error -= 2LL * length & across;
+	}
+	*p = color;
+}
+
+/** Draws the part of a segment that is in the buffer. The pixels along
+ *  the line that are in range, and the ones that have stepped across
+ *  few enough and not too many times, are both a run of the walk's
+ *  pixels, so their overlap is found up front and then drawn with
+ *  drawInside from the middle of the walk. Returns the number of pixels
+ *  drawn.
+ */
+static size_t drawClipped(const Segment &s, const Walk &w,
+	PixelBuffer &buffer, uint32_t color) {
+	int o = w.octant;
+	bool alongX = majorY[o] == 0;
+	long long kLo, kHi, vLo, vHi;
+	if (alongX) {
+		stepsInside(s.x0, majorX[o], buffer.width, kLo, kHi);
+		stepsInside(s.y0, minorY[o], buffer.height, vLo, vHi);
+	}
+	else {
+		stepsInside(s.y0, majorY[o], buffer.height, kLo, kHi);
+		stepsInside(s.x0, minorX[o], buffer.width, vLo, vHi);
+	}
+	kLo = max(max(kLo, 0LL), firstWithRise(w, vLo));
+	kHi = min(min(kHi, (long long) w.length), lastWithRise(w, vHi));
+	if (kLo > kHi)
+		return 0;
+
+	long long v = riseAt(w, kLo);
+	long long x = s.x0 + majorX[o] * kLo + minorX[o] * v;
+	long long y = s.y0 + majorY[o] * kLo + minorY[o] * v;
+	drawInside(buffer.pixels + y * buffer.stride + x,
+		majorX[o] + (ptrdiff_t) majorY[o] * buffer.stride,
+		minorX[o] + (ptrdiff_t) minorY[o] * buffer.stride,
+		kHi - kLo, w.length, w.rise,
+		2LL * w.rise * (kLo + 1) - w.length - 2LL * w.length * v, color);
+	return kHi - kLo + 1;
+}
+
+/**
+ * Draws the n segments into the buffer, with exactly the pixels line()
+ * would give them, and returns how many pixels were drawn. Only the
+ * part of each segment that is in the buffer is walked, so the buffer
+ * can be a window onto a larger frame. Nothing is allocated.
+ */
+size_t rasterize(const Segment *segments, size_t n, PixelBuffer &buffer,
+	uint32_t color) {
+	size_t drawn = 0;
+	for (size_t i = 0; i < n; i++) {
+		const Segment &s = segments[i];
+		Walk w = walkOf(s);
+		if (!inside(s, buffer)) {
+			drawn += drawClipped(s, w, buffer, color);
+			continue;
+		}
+		int o = w.octant;
+		drawInside(buffer.pixels + (ptrdiff_t) s.y0 * buffer.stride + s.x0,
+			majorX[o] + (ptrdiff_t) majorY[o] * buffer.stride,
+			minorX[o] + (ptrdiff_t) minorY[o] * buffer.stride,
+			w.length, w.length, w.rise, 2 * w.rise - w.length, color);
+		drawn += w.length + 1;
+	}
+	return drawn;
+}
+
+/** The lengths of the runs of pixels that line() puts in a row (or in
+ *  a column, for steep lines) before stepping across. Apart from the
+ *  first and the last, every run is q or q + 1 pixels long, and which
+ *  one follows from a remainder kept like Bresenham's error term.
+ */
+struct Runs {
+	int q;
+	int rem;
+	int twoRise;
+	int left;
+	int first;
+
+	/** Sets up the runs of a segment with rise <= length. The first run
+	 *  is the number of pixels it takes 2 * rise - length to reach
+	 *  length, adding 2 * rise a pixel; the others come from the
+	 *  remainder left over, plus 2 * length - 2 * rise each time. A
+	 *  segment with no rise is all one run.
+	 */
+	Runs(int length, int rise) {
+		if (rise == 0) {
+			q = rem = twoRise = left = 0;
+			first = length + 1;
+			return;
+		}
+		twoRise = 2 * rise;
+		q = length / rise;
+		rem = 2 * (length % rise);
+		// Only -1 for diagonal lines, whose runs are all one pixel
+		int b = 2 * (length - rise) - 1;
+		left = b % twoRise;
+		first = b / twoRise + 1;
+	}
+
+	int next() {
+		left += rem;
+		if (left >= twoRise) {
+			left -= twoRise;
+			return q + 1;
+		}
+		return q;
+	}
+};
+
+/** drawInside for one octant, known at compile time. Rather than
+ *  decide at every pixel whether to step across, it draws whole runs
+ *  (see Runs), so the inner loop only stores; for lines that step
+ *  along x, a run is a row of adjacent pixels.
+ */
+template <int Octant>
+static inline void drawOctant(uint32_t *p, ptrdiff_t stride, int length,
+	int rise, uint32_t color) {
+	const bool alongX = Octant == 0 || Octant == 3 || Octant == 4 || Octant == 7;
+	const int sx = (Octant >= 2 && Octant <= 5) ? -1 : 1;
+	const int sy = Octant >= 4 ? -1 : 1;
+	const ptrdiff_t major = alongX ? sx : sy * stride;
+	const ptrdiff_t minor = alongX ? sy * stride : sx;
+
+	int left = length + 1;
+	Runs runs(length, rise);
+	int run = runs.first;
+	while (run < left) {
+		for (int k = 0; k < run; k++)
+			p[k * major] = color;
+		p += run * major + minor;
+		left -= run;
+		run = runs.next();
+	}
+	for (int k = 0; k < left; k++)
+		p[k * major] = color;
+}
+
+/**
+ * The same as rasterize, but with the walk compiled separately for each
+ * octant (the switch picks one per segment, not per pixel).
+ */
+size_t rasterizeUnrolled(const Segment *segments, size_t n,
+	PixelBuffer &buffer, uint32_t color) {
+	size_t drawn = 0;
+	ptrdiff_t stride = buffer.stride;
+	for (size_t i = 0; i < n; i++) {
+		const Segment &s = segments[i];
+		Walk w = walkOf(s);
+		if (!inside(s, buffer)) {
+			drawn += drawClipped(s, w, buffer, color);
+			continue;
+		}
+		uint32_t *p = buffer.pixels + (ptrdiff_t) s.y0 * stride + s.x0;
+		switch (w.octant) {
+			case 0: drawOctant<0>(p, stride, w.length, w.rise, color); break;
+			case 1: drawOctant<1>(p, stride, w.length, w.rise, color); break;
+			case 2: drawOctant<2>(p, stride, w.length, w.rise, color); break;
+			case 3: drawOctant<3>(p, stride, w.length, w.rise, color); break;
+			case 4: drawOctant<4>(p, stride, w.length, w.rise, color); break;
+			case 5: drawOctant<5>(p, stride, w.length, w.rise, color); break;
+			case 6: drawOctant<6>(p, stride, w.length, w.rise, color); break;
+			case 7: drawOctant<7>(p, stride, w.length, w.rise, color); break;
+		}
+		drawn += w.length + 1;
+	}
+	return drawn;
+}
+
+/**
+ * Appends the pixels of the n segments to spans, as runs along rows: one
+ * span per row for lines that step along x, one per pixel otherwise. The
+ * spans of each segment go from its first end to its second. Returns the
+ * number of spans added; spans only allocates when it has to grow, so
+ * reserving it up front avoids even that.
+ */
+size_t rasterizeSpans(const Segment *segments, size_t n, vector<Span> &spans) {
+	size_t before = spans.size();
+	for (size_t i = 0; i < n; i++) {
+		const Segment &s = segments[i];
+		Walk w = walkOf(s);
+		int o = w.octant;
+		bool alongX = majorY[o] == 0;
+		// One span per run, so all of them can be added at once
+		size_t count = (alongX ? w.rise : w.length) + 1;
+		size_t at = spans.size();
+		spans.resize(at + count);
+		Span *out = &spans[at];
+		int x = s.x0, y = s.y0;
+		if (!alongX) {
+			// A column of one-pixel spans, stepping across by a mask as
+			// in drawInside
+			int error = 2 * w.rise - w.length;
+			for (int k = 0; k <= w.length; k++) {
+				out[k].y = y;
+				out[k].x0 = out[k].x1 = x;
+				error += 2 * w.rise;
+				int across = -(error >= w.length);
+				y += majorY[o];
+				x += minorX[o] & across;
+				error -= 2 * w.length & across;
+			}
+			continue;
+		}
+		int left = w.length + 1;
+		Runs runs(w.length, w.rise);
+		int run = runs.first;
+		for (size_t k = 0; k < count; k++) {
+			if (run > left)
+				run = left;
+			int end = x + majorX[o] * (run - 1);
+			out[k].y = y;
+			out[k].x0 = min(x, end);
+			out[k].x1 = max(x, end);
+			x = end + majorX[o];
+			y += minorY[o];
+			left -= run;
+			if (k + 1 < count)
+				run = runs.next();
+		}
+	}
+	return spans.size() - before;
+}
+
+#ifdef __AVX2__
+/** Draws eight segments at once, all inside the buffer, one AVX2 lane
+ *  each. The octant is never worked out as such: blends pick each lane's
+ *  length, rise and pixel steps straight from the signs and sizes of its
+ *  x and y distances, the same way findOctant and switchFromOctantZero
+ *  would. Then every lane takes the same steps as drawInside, with lanes
+ *  whose segment is done masked so that they stay on their last pixel.
+ *  AVX2 cannot scatter, so the stores are done lane by lane.
+ */
+static void drawEight(const int32_t *x0, const int32_t *y0, const int32_t *x1,
+	const int32_t *y1, PixelBuffer &buffer, uint32_t color) {
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i one = _mm256_set1_epi32(1);
+	const __m256i minusOne = _mm256_set1_epi32(-1);
+	const __m256i stride = _mm256_set1_epi32(buffer.stride);
+	__m256i X0 = _mm256_loadu_si256((const __m256i *) x0);
+	__m256i Y0 = _mm256_loadu_si256((const __m256i *) y0);
+	__m256i dx = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *) x1), X0);
+	__m256i dy = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *) y1), Y0);
+	__m256i adx = _mm256_abs_epi32(dx);
+	__m256i ady = _mm256_abs_epi32(dy);
+
+	// Steep (octants 1, 2, 5, 6) when |dy| >= |dx|, as in findOctant
+	__m256i steep = _mm256_xor_si256(_mm256_cmpgt_epi32(adx, ady), minusOne);
+	__m256i length = _mm256_blendv_epi8(adx, ady, steep);
+	__m256i rise = _mm256_blendv_epi8(ady, adx, steep);
+	// x goes back only when dx < 0, and y forward only when dy > 0
+	__m256i sx = _mm256_blendv_epi8(one, minusOne, _mm256_cmpgt_epi32(zero, dx));
+	__m256i sy = _mm256_blendv_epi8(minusOne, one, _mm256_cmpgt_epi32(dy, zero));
+	__m256i rows = _mm256_mullo_epi32(sy, stride);
+	__m256i major = _mm256_blendv_epi8(sx, rows, steep);
+	__m256i minor = _mm256_blendv_epi8(rows, sx, steep);
+
+	__m256i at = _mm256_add_epi32(_mm256_mullo_epi32(Y0, stride), X0);
+	__m256i twoRise = _mm256_add_epi32(rise, rise);
+	__m256i twoLength = _mm256_add_epi32(length, length);
+	__m256i lengthLess1 = _mm256_sub_epi32(length, one);
+	__m256i error = _mm256_sub_epi32(twoRise, length);
+	__m256i left = length;
+
+	alignas(32) int32_t lane[8];
+	_mm256_store_si256((__m256i *) lane, length);
+	int32_t steps = 0;
+	for (int l = 0; l < 8; l++)
+		steps = max(steps, lane[l]);
+
+	uint32_t *pixels = buffer.pixels;
+	for (int32_t k = 0; ; k++) {
+		_mm256_store_si256((__m256i *) lane, at);
+		for (int l = 0; l < 8; l++)
+			pixels[lane[l]] = color;
+		if (k == steps)
+			break;
+		error = _mm256_add_epi32(error, twoRise);
+		__m256i across = _mm256_cmpgt_epi32(error, lengthLess1);
+		__m256i moving = _mm256_cmpgt_epi32(left, zero);
+		__m256i step = _mm256_add_epi32(major, _mm256_and_si256(minor, across));
+		at = _mm256_add_epi32(at, _mm256_and_si256(step, moving));
+		error = _mm256_sub_epi32(error, _mm256_and_si256(twoLength, across));
+		left = _mm256_sub_epi32(left, one);
+	}
+}
+#endif
+
+/**
+ * The same as rasterize, with the segments that are inside the buffer
+ * drawn eight at a time with AVX2 (see drawEight), for batches of many
+ * short segments where setting each one up costs about as much as
+ * drawing it. Every segment gets the same color, so the order the lanes'
+ * pixels are stored in does not matter. Segments that stick out of the
+ * buffer, and all of them without AVX2 or in a buffer of 2^31 pixels or
+ * more, are drawn one at a time as in rasterize.
+ */
+size_t rasterizeSimd(const Segment *segments, size_t n, PixelBuffer &buffer,
+	uint32_t color) {
+#ifdef __AVX2__
+	if ((long long) buffer.height * buffer.stride >= (1LL << 31))
+		return rasterize(segments, n, buffer, color);
+	alignas(32) int32_t x0[8], y0[8], x1[8], y1[8];
+	int lanes = 0;
+	size_t drawn = 0;
+	for (size_t i = 0; i < n; i++) {
+		const Segment &s = segments[i];
+		if (!inside(s, buffer)) {
+			drawn += drawClipped(s, walkOf(s), buffer, color);
+			continue;
+		}
+		x0[lanes] = s.x0;
+		y0[lanes] = s.y0;
+		x1[lanes] = s.x1;
+		y1[lanes] = s.y1;
+		drawn += max(abs(s.x1 - s.x0), abs(s.y1 - s.y0)) + 1;
+		if (++lanes == 8) {
+			drawEight(x0, y0, x1, y1, buffer, color);
+			lanes = 0;
+		}
+	}
+	if (lanes > 0) {
+		// Fill the spare lanes with copies of the first, which just
+		// draw its pixels again
+		for (int l = lanes; l < 8; l++) {
+			x0[l] = x0[0];
+			y0[l] = y0[0];
+			x1[l] = x1[0];
+			y1[l] = y1[0];
+		}
+		drawEight(x0, y0, x1, y1, buffer, color);
+	}
+	return drawn;
+#else
+	return rasterize(segments, n, buffer, color);
+#endif
+}
+
+/** Mixes color into the pixel at p with weight alpha out of 256, each
+ *  channel at once: red and blue together, then green
+ */
+static inline void blend(uint32_t *p, uint32_t color, uint32_t alpha) {
+	uint32_t old = *p;
+	uint32_t rb = (((color & 0xff00ff) * alpha + (old & 0xff00ff) * (256 - alpha))
+		>> 8) & 0xff00ff;
+	uint32_t g = (((color & 0x00ff00) * alpha + (old & 0x00ff00) * (256 - alpha))
+		>> 8) & 0x00ff00;
+	*p = rb | g;
+}
+
+/**
+ * Draws the n segments into the buffer anti-aliased, with Xiaolin Wu's
+ * algorithm: at each step along the line, the two pixels either side of
+ * the exact line are blended with color in proportion to how close the
+ * line passes. Ends are integers here, so they get one full pixel each.
+ * Colors are 0xRRGGBB. Pixels outside the buffer are skipped, as in
+ * rasterize, and the pixels a segment gets do not depend on where the
+ * buffer is. Returns the number of pixels blended.
+ */
+size_t rasterizeWu(const Segment *segments, size_t n, PixelBuffer &buffer,
+	uint32_t color) {
+	size_t drawn = 0;
+	for (size_t i = 0; i < n; i++) {
+		const Segment &s = segments[i];
+		// a runs along the line and b across it, so that |db| <= |da|
+		bool steep = abs(s.y1 - s.y0) > abs(s.x1 - s.x0);
+		long long a0 = steep ? s.y0 : s.x0, b0 = steep ? s.x0 : s.y0;
+		long long da = steep ? s.y1 - s.y0 : s.x1 - s.x0;
+		long long db = steep ? s.x1 - s.x0 : s.y1 - s.y0;
+		if (da < 0) {
+			a0 += da;
+			b0 += db;
+			da = -da;
+			db = -db;
+		}
+		long long aSize = steep ? buffer.height : buffer.width;
+		long long bSize = steep ? buffer.width : buffer.height;
+		ptrdiff_t aStep = steep ? buffer.stride : 1;
+		ptrdiff_t bStep = steep ? 1 : buffer.stride;
+		double gradient = da == 0 ? 0 : (double) db / da;
+
+		long long kLo = max(0LL, -a0), kHi = min(da, aSize - 1 - a0);
+		for (long long k = kLo; k <= kHi; k++) {
+			double t = gradient * k;
+			double below = floor(t);
+			// The share of the pixel past the line
+			uint32_t alpha = (uint32_t) ((t - below) * 256);
+			long long b = b0 + (long long) below;
+			uint32_t *p = buffer.pixels + (a0 + k) * aStep;
+			if (b >= 0 && b < bSize) {
+				blend(p + b * bStep, color, 256 - alpha);
+				drawn++;
+			}
+			if (alpha > 0 && b + 1 >= 0 && b + 1 < bSize) {
+				blend(p + (b + 1) * bStep, color, alpha);
+				drawn++;
+			}
+		}
+	}
+	return drawn;
+}
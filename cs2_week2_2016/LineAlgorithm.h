@@ -16,7 +16,14 @@
 #include <cstdlib>
 #include <stdlib.h>
 #include <iostream>
+#include <cstddef>
+#include <stdint.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#ifndef HEADLESS
 #include "LineApp.h"
+#endif
 #include "structs.h"
 
 using namespace std;
@@ -26,4 +33,52 @@ vector<Tuple> line(Tuple p1, Tuple p2);
 Tuple switchToOctantZero(int octant, int x, int y);
 Tuple switchFromOctantZero(int octant, int x, int y);
 int findOctant(Tuple p1, Tuple p2);
+
+/**
+ * @brief A line segment from (x0, y0) to (x1, y1); both ends are drawn.
+ */
+struct Segment
+{
+    int x0, y0, x1, y1;
+
+    Segment(int x0, int y0, int x1, int y1)
+        : x0(x0), y0(y0), x1(x1), y1(y1) { }
+};
+
+/**
+ * @brief A run of pixels in row y, from x0 to x1 inclusive (x0 <= x1).
+ */
+struct Span
+{
+    int y, x0, x1;
+};
+
+/**
+ * @brief A caller-owned block of 32-bit pixels, row by row; pixel (x, y)
+ * is pixels[y * stride + x].
+ */
+struct PixelBuffer
+{
+    uint32_t *pixels;
+    int width, height;
+
+    /**
+     * @brief Distance from one row to the next, in pixels (at least width).
+     */
+    int stride;
+
+    PixelBuffer(uint32_t *pixels, int width, int height, int stride)
+        : pixels(pixels), width(width), height(height), stride(stride) { }
+};
+
+// Batch rasterizers: the same pixels as line(), without the allocations
+size_t rasterize(const Segment *segments, size_t n, PixelBuffer &buffer,
+    uint32_t color);
+size_t rasterizeUnrolled(const Segment *segments, size_t n,
+    PixelBuffer &buffer, uint32_t color);
+size_t rasterizeSpans(const Segment *segments, size_t n, vector<Span> &spans);
+size_t rasterizeSimd(const Segment *segments, size_t n, PixelBuffer &buffer,
+    uint32_t color);
+size_t rasterizeWu(const Segment *segments, size_t n, PixelBuffer &buffer,
+    uint32_t color);
 #endif
@@ -0,0 +1,254 @@
+/**
+ * @file
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief A multithreaded, tiled renderer for large batches of line
+ * segments (implementation).
+ *
+ */
+#include <algorithm>
+#include <cstdio>
+#include "LineRenderer.h"
+
+/**
+ * floor(a / b) for b > 0, rounding down rather than towards zero.
+ */
+static inline long long floorDiv(long long a, long long b)
+{
+	return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+/**
+ * @brief Makes a renderer with a width x height frame, cleared to black,
+ * that uses up to nthreads threads, or one per core if nthreads is 0.
+ */
+LineRenderer::LineRenderer(int width, int height, int nthreads)
+	: pixels((size_t) width * height, 0),
+	  frame(pixels.data(), width, height, width)
+{
+	if (nthreads < 1) nthreads = std::thread::hardware_concurrency();
+	if (nthreads < 1) nthreads = 1;
+	this->nthreads = nthreads;
+	tilesX = (width + LINE_TILE_SIZE - 1) / LINE_TILE_SIZE;
+	tilesY = (height + LINE_TILE_SIZE - 1) / LINE_TILE_SIZE;
+	bins.resize(nthreads);
+	for (int t = 0; t < nthreads; t++) bins[t].resize((size_t) tilesX * tilesY);
+
+	batch = NULL;
+	batchSize = 0;
+	batchColor = 0;
+	batchAntialias = false;
+	generation = 0;
+	running = 0;
+	stopping = false;
+	task = NULL;
+	for (int t = 1; t < nthreads; t++)
+		workers.push_back(std::thread(&LineRenderer::workerLoop, this, t));
+}
+
+/**
+ * @brief Stops the pool's threads.
+ */
+LineRenderer::~LineRenderer()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+		generation++;
+	}
+	wake.notify_all();
+	for (unsigned int t = 0; t < workers.size(); t++) workers[t].join();
+}
+
+/**
+ * @brief Runs task on every thread of the pool, including this one as
+ * worker 0, and returns once they have all finished.
+ */
+void LineRenderer::runOnAll(void (LineRenderer::*task)(int worker))
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		this->task = task;
+		running = nthreads - 1;
+		generation++;
+	}
+	wake.notify_all();
+	(this->*task)(0);
+	std::unique_lock<std::mutex> guard(lock);
+	while (running > 0) done.wait(guard);
+}
+
+/**
+ * The loop each of the pool's threads runs until the renderer goes away.
+ */
+void LineRenderer::workerLoop(int worker)
+{
+	unsigned long seen = 0;
+	std::unique_lock<std::mutex> guard(lock);
+	while (true) {
+		while (generation == seen) wake.wait(guard);
+		seen = generation;
+		if (stopping) return;
+		void (LineRenderer::*current)(int) = task;
+		guard.unlock();
+		(this->*current)(worker);
+		guard.lock();
+		if (--running == 0) done.notify_one();
+	}
+}
+
+/**
+ * @brief Sets every pixel of the frame to color.
+ */
+void LineRenderer::clear(uint32_t color)
+{
+	std::fill(pixels.begin(), pixels.end(), color);
+}
+
+/**
+ * @brief Draws segments[0, n) into the frame in color, anti-aliased with
+ * Wu's algorithm if antialias is set. Later segments are drawn over (or,
+ * anti-aliased, blended over) earlier ones.
+ *
+ * @return the number of pixels drawn.
+ */
+size_t LineRenderer::draw(const Segment *segments, size_t n, uint32_t color,
+	bool antialias)
+{
+	batch = segments;
+	batchSize = n;
+	batchColor = color;
+	batchAntialias = antialias;
+	runOnAll(&LineRenderer::binSegments);
+	nextTile = 0;
+	drawn = 0;
+	runOnAll(&LineRenderer::drawTiles);
+	batch = NULL;
+	return drawn;
+}
+
+/**
+ * Step 1 of draw for one thread: puts each of its share of the batch in
+ * its bins for the tiles the segment passes through.
+ *
+ * The segment is followed one slab of tiles at a time along its longer
+ * axis (a), and within a slab it is no more than a pixel from the exact
+ * line across it (b), on either side, in both modes, which bounds the
+ * tiles across the slab it can reach. Binning a segment into a tile it
+ * turns out to miss costs nothing but the time to find that out.
+ */
+void LineRenderer::binSegments(int worker)
+{
+	std::vector<std::vector<uint32_t> > &mine = bins[worker];
+	for (size_t i = 0; i < mine.size(); i++) mine[i].clear();
+	size_t begin = batchSize * worker / nthreads;
+	size_t end = batchSize * (worker + 1) / nthreads;
+	const long long T = LINE_TILE_SIZE;
+
+	for (size_t i = begin; i < end; i++) {
+		const Segment &s = batch[i];
+		// Most short segments are inside one tile
+		int tx = s.x0 / LINE_TILE_SIZE, ty = s.y0 / LINE_TILE_SIZE;
+		if (s.x0 >= 0 && s.y0 >= 0 && s.x1 >= 0 && s.y1 >= 0
+			&& tx < tilesX && ty < tilesY
+			&& s.x1 / LINE_TILE_SIZE == tx && s.y1 / LINE_TILE_SIZE == ty
+			&& s.x0 < frame.width && s.x1 < frame.width
+			&& s.y0 < frame.height && s.y1 < frame.height) {
+			// Wu's second pixel can be one past the end, across the line
+			if (!batchAntialias) {
+				mine[tx + (size_t) ty * tilesX].push_back((uint32_t) i);
+				continue;
+			}
+		}
+		bool steep = abs(s.y1 - s.y0) > abs(s.x1 - s.x0);
+		long long a0 = steep ? s.y0 : s.x0, b0 = steep ? s.x0 : s.y0;
+		long long da = steep ? s.y1 - s.y0 : s.x1 - s.x0;
+		long long db = steep ? s.x1 - s.x0 : s.y1 - s.y0;
+		if (da < 0) {
+			a0 += da;
+			b0 += db;
+			da = -da;
+			db = -db;
+		}
+		long long aSize = steep ? frame.height : frame.width;
+		long long bTiles = steep ? tilesX : tilesY;
+		long long aFirst = std::max(a0, 0LL);
+		long long aLast = std::min(a0 + da, aSize - 1);
+		for (long long slab = aFirst / T; aFirst <= aLast && slab <= aLast / T; slab++) {
+			long long kA = std::max(slab * T, aFirst) - a0;
+			long long kB = std::min(slab * T + T - 1, aLast) - a0;
+			long long bLo, bHi;
+			if (da == 0) {
+				bLo = bHi = b0;
+			}
+			else {
+				long long ends[2] = { db * kA, db * kB };
+				if (ends[0] > ends[1]) std::swap(ends[0], ends[1]);
+				bLo = b0 + floorDiv(ends[0], da) - 1;
+				bHi = b0 + floorDiv(ends[1] + da - 1, da) + 1;
+			}
+			long long first = std::max(floorDiv(bLo, T), 0LL);
+			long long last = std::min(floorDiv(bHi, T), bTiles - 1);
+			for (long long across = first; across <= last; across++) {
+				size_t tile = steep ? across + slab * tilesX : slab + across * tilesX;
+				mine[tile].push_back((uint32_t) i);
+			}
+		}
+	}
+}
+
+/**
+ * Step 2 of draw for one thread: takes tiles until there are none left,
+ * and draws each one's segments into it, through a PixelBuffer that is a
+ * window onto that part of the frame.
+ */
+void LineRenderer::drawTiles(int worker)
+{
+	size_t tiles = (size_t) tilesX * tilesY;
+	size_t count = 0;
+	for (size_t tile = nextTile++; tile < tiles; tile = nextTile++) {
+		int left = (tile % tilesX) * LINE_TILE_SIZE;
+		int top = (tile / tilesX) * LINE_TILE_SIZE;
+		PixelBuffer window(frame.pixels + (ptrdiff_t) top * frame.stride + left,
+			std::min(LINE_TILE_SIZE, frame.width - left),
+			std::min(LINE_TILE_SIZE, frame.height - top), frame.stride);
+		for (int t = 0; t < nthreads; t++) {
+			const std::vector<uint32_t> &bin = bins[t][tile];
+			for (size_t i = 0; i < bin.size(); i++) {
+				const Segment &s = batch[bin[i]];
+				Segment moved(s.x0 - left, s.y0 - top, s.x1 - left, s.y1 - top);
+				if (batchAntialias)
+					count += rasterizeWu(&moved, 1, window, batchColor);
+				else
+					count += rasterize(&moved, 1, window, batchColor);
+			}
+		}
+	}
+	drawn += count;
+}
+
+/**
+ * @brief Writes the frame to a binary PPM (P6) file.
+ *
+ * @return `false` if the file cannot be written.
+ */
+bool LineRenderer::writePPM(const char *filename) const
+{
+	FILE *f = fopen(filename, "wb");
+	if (f == NULL) return false;
+	fprintf(f, "P6\n%d %d\n255\n", frame.width, frame.height);
+	std::vector<unsigned char> row(3 * (size_t) frame.width);
+	bool ok = true;
+	for (int y = 0; ok && y < frame.height; y++) {
+		const uint32_t *p = frame.pixels + (ptrdiff_t) y * frame.stride;
+		for (int x = 0; x < frame.width; x++) {
+			row[3 * x] = p[x] >> 16;
+			row[3 * x + 1] = p[x] >> 8;
+			row[3 * x + 2] = p[x];
+		}
+		ok = fwrite(row.data(), 1, row.size(), f) == row.size();
+	}
+	return fclose(f) == 0 && ok;
+}
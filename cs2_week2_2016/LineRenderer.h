@@ -0,0 +1,103 @@
+/**
+ * @file
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief A multithreaded, tiled renderer for large batches of line
+ * segments (header file).
+ *
+ */
+#ifndef __LINERENDERER_H__
+#define __LINERENDERER_H__
+
+#include <vector>
+#include <cstddef>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "LineAlgorithm.h"
+
+/**
+ * @brief Width and height of a tile, in pixels.
+ */
+#ifndef LINE_TILE_SIZE
+#define LINE_TILE_SIZE 128
+#endif
+
+/**
+ * @brief Draws batches of segments into a frame of its own, in parallel.
+ *
+ * draw() works in two steps, each shared between the threads of a pool
+ * that lives as long as the renderer:
+ * 1. Binning. Each thread takes an equal share of the segments and, for
+ *    each one, adds it to the bin of every tile it passes through. Every
+ *    thread has its own bins, so nothing is shared.
+ * 2. Drawing. The threads take tiles one at a time, and draw the
+ *    segments in the tile's bins (in their order in the batch) into the
+ *    part of the frame the tile covers. No two threads ever have the
+ *    same tile, so they write to the frame without locks.
+ *
+ * The pixels come out the same as drawing the whole batch with
+ * rasterize (or rasterizeWu, when anti-aliased) on one thread. Colors
+ * are 0xRRGGBB.
+ */
+class LineRenderer
+{
+public:
+    LineRenderer(int width, int height, int nthreads = 0);
+    ~LineRenderer();
+
+    void clear(uint32_t color);
+    size_t draw(const Segment *segments, size_t n, uint32_t color,
+        bool antialias = false);
+    bool writePPM(const char *filename) const;
+
+    /**
+     * @brief The frame, to read or to draw into directly.
+     */
+    PixelBuffer &buffer() { return frame; }
+
+    /**
+     * @brief The number of threads that draw() uses, counting the one
+     * that calls it.
+     */
+    int threads() const { return nthreads; }
+
+private:
+    int nthreads;
+    int tilesX, tilesY;
+    std::vector<uint32_t> pixels;
+    PixelBuffer frame;
+
+    /**
+     * @brief bins[t][i]: the segments that thread t found in tile i.
+     */
+    std::vector<std::vector<std::vector<uint32_t> > > bins;
+
+    // The batch being drawn
+    const Segment *batch;
+    size_t batchSize;
+    uint32_t batchColor;
+    bool batchAntialias;
+    std::atomic<size_t> nextTile;
+    std::atomic<size_t> drawn;
+
+    // The pool: workers 1 to nthreads - 1 wait for each new generation,
+    // run the task, and count themselves out; the caller is worker 0
+    std::vector<std::thread> workers;
+    std::mutex lock;
+    std::condition_variable wake, done;
+    unsigned long generation;
+    int running;
+    bool stopping;
+    void (LineRenderer::*task)(int worker);
+
+    void runOnAll(void (LineRenderer::*task)(int worker));
+    void workerLoop(int worker);
+    void binSegments(int worker);
+    void drawTiles(int worker);
+};
+
+#endif
@@ -9,6 +9,7 @@
  *
  */
 #include "structs.h"
+#include "sortlib.h"
 #include <vector>
 
 #include <iostream>
@@ -16,53 +17,23 @@
 using namespace std;
 
 /**
- * Swap two elements of points and angles, given the indices to switch
+ * Sorts points by their angles in ascending order, using the sort library.
+ * It takes in vectors of points and their corresponding angles, with the
+ * angles pointing to the point with the same index in that vector. Each
+ * point is paired with its angle so the two can never get out of step,
+ * sorted by the angle as its key, and then unpaired again.
  */
-void swap(vector<Tuple*> &points, vector<double> &angles, int i, int j) {
-	// Switch the elements at the indices of angles
-	double temp1 = angles[i];
-	angles[i] = angles[j];
-	angles[j] = temp1;
-
-	// Switch the elements at the indices of points
-	Tuple* temp2 = points[i];
-	points[i] = points[j];
-	points[j] = temp2;
-}
-
-/**
- * Uses quick sort in place to sort an array of points by their angles
- * in ascending order. It takes in vectors of points and their corresponding
- * angles, with the angles pointing to the point with the same index in
- * that vector.
- */
- 
-void sort(vector<Tuple*> &points, vector<double> &angles, int left, int right)
+void sortByAngle(vector<Tuple*> &points, vector<double> &angles)
 {
-	// Ends when size of vector is one
-	if (left >= right) return;
-	// Chooses the pivot to be the midpoint
-	double pivot = angles[(left + right)/2];
-	int i = left, j = right;
-	while (i <= j) {
-		// Finds the point for which the angle is greater than the
-		// pivot value in the first half of the vector
-		while (angles[i] < pivot) i++;
-		// Finds the point for which the angle is less than the pivot
-		// value in the second half of the vector
-		while (angles[j] > pivot) j--;
-		// As long as the first coordinate is less than the second,
-		// swaps them
-		if (i <= j) {
-			swap(points, angles, i, j);
-			i++;
-			j--;
-		}
-	}
-	// Recursively use quicksort in place to sort the two halves.
-	if (left < j) sort(points, angles, left, j);
-	if (i < right) sort(points, angles, i, right);
-    return;
+    vector<AnglePoint> byAngle;
+    for (unsigned int i = 0; i < points.size(); i++)
+        byAngle.push_back(AnglePoint(angles[i], points[i]));
+    sortlib::introsort(byAngle.begin(), byAngle.end(),
+        [](const AnglePoint &p) { return p.angle; });
+    for (unsigned int i = 0; i < byAngle.size(); i++) {
+        angles[i] = byAngle[i].angle;
+        points[i] = byAngle[i].point;
+    }
 }
 
 
@@ -87,7 +58,7 @@ int main(int argc, char const *argv[])
     // Now sort them with respect to angle (points[i] corresponds to angle[i])
 
     /** THIS IS THE ONLY LINE OF THE MAIN LOOP YOU NEED TO MODIFY. */
-    sort(points, angles, 0, angles.size() - 1);
+    sortByAngle(points, angles);
     /** REPLACE THE LINE ABOVE WITH A CALL TO YOUR SORTING FUNCTION. */
 
     // and print out the new points and angles
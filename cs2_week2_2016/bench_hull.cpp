@@ -0,0 +1,198 @@
+/**
+ * @file bench_hull.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Benchmarks Chan's algorithm against gift wrapping and Graham scan
+ * as both the number of points n and the number of hull points h vary.
+ *
+ * For each n and h, exactly h points are put evenly around a circle and the
+ * other n - h at random strictly inside the polygon they form, so the hull
+ * is known in advance. A row with h = 0 uses uniform points in a square
+ * instead, whose hull has O(log n) points. Prints one CSV row per
+ * (algorithm, n, h) with the median time, and whether the hull found has
+ * the expected number of points.
+ *
+ * Built with -DHEADLESS; gift wrapping takes O(n h^2) time here (its
+ * checkOnHull scan is O(h)), so it is skipped where that gets too large.
+ */
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <cmath>
+#include "HullAlgorithms.h"
+
+/**
+ * @brief Radius of the circle the hull points are put on.
+ */
+#define BENCH_RADIUS (1 << 20)
+
+/**
+ * @brief Gift wrapping is skipped when n h^2 is larger than this.
+ */
+#define GIFT_WRAP_MAX_WORK 2e10
+
+/**
+ * @brief One algorithm: its name, and how to run it on the points (given
+ * both as Tuples and as a PointSet) and return the number of points it
+ * reports, including the first one again at the end.
+ *
+ * Gift wrapping and Graham scan work on the PointSet, which is built
+ * before the timer starts; the others work on the Tuples.
+ */
+struct HullMode
+{
+    const char *name;
+    size_t (*run)(vector<Tuple*> &points, const PointSet &set);
+};
+
+static size_t run_chan(vector<Tuple*> &points, const PointSet &)
+{
+    ConvexHullApp app;
+    DoChan(points, &app);
+    return app.hull.size();
+}
+
+static size_t run_graham(vector<Tuple*> &, const PointSet &set)
+{
+    vector<int> hull;
+    grahamScan(set, hull);
+    return hull.size();
+}
+
+static size_t run_gift_wrap(vector<Tuple*> &, const PointSet &set)
+{
+    vector<int> hull;
+    giftWrap(set, hull);
+    return hull.size();
+}
+
+static size_t run_monotone(vector<Tuple*> &points, const PointSet &)
+{
+    ConvexHullApp app;
+    DoMonotoneChain(points, &app);
+    return app.hull.size();
+}
+
+const HullMode hull_modes[] =
+{
+    { "chan",      run_chan },
+    { "graham",    run_graham },
+    { "gift-wrap", run_gift_wrap },
+    // Not the subject of the comparison, but an O(n log n) yardstick
+    { "monotone",  run_monotone },
+};
+
+const char *bench_usage_string =
+"Usage: bench_hull [-t TRIALS] [-n MAX_SIZE] [-s SEED]\n\
+    Benchmarks the hull algorithms and prints CSV to stdout.\n\
+    -t TRIALS   trials per algorithm, n and h (default: 5)\n\
+    -n MAX_SIZE largest number of points; n goes up by 10x from 1000\n\
+                (default: 1000000)\n\
+    -s SEED     seed for the input generator (default: 1)\n";
+
+/**
+ * @brief Fills points with n points whose hull has exactly h of them, or
+ * with n uniform points in a square if h is 0. The points are shuffled, so
+ * that the hull points are not all at the front.
+ */
+void generate(vector<Tuple*> &points, size_t n, size_t h, std::mt19937 &rng)
+{
+    for (size_t i = 0; i < points.size(); i++) delete points[i];
+    points.clear();
+    if (h == 0)
+    {
+        std::uniform_int_distribution<int> coord(-BENCH_RADIUS, BENCH_RADIUS);
+        for (size_t i = 0; i < n; i++)
+            points.push_back(new Tuple(coord(rng), coord(rng)));
+        return;
+    }
+    for (size_t i = 0; i < h; i++)
+    {
+        double a = 2 * M_PI * i / h;
+        points.push_back(new Tuple((int) lround(BENCH_RADIUS * cos(a)),
+            (int) lround(BENCH_RADIUS * sin(a))));
+    }
+    // Everything else goes in the polygon's inscribed circle, pulled in a
+    // little so rounding cannot push it onto an edge
+    double r = 0.99 * BENCH_RADIUS * cos(M_PI / h);
+    std::uniform_real_distribution<double> unit(-1, 1);
+    while (points.size() < n)
+    {
+        double x = unit(rng), y = unit(rng);
+        if (x * x + y * y > 1) continue;
+        points.push_back(new Tuple((int) (r * x), (int) (r * y)));
+    }
+    std::shuffle(points.begin(), points.end(), rng);
+}
+
+int main(int argc, char *argv[])
+{
+    int trials = 5;
+    size_t max_size = 1000000;
+    unsigned int seed = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *arg = argv[i];
+        if (i + 1 < argc && strcmp(arg, "-t") == 0) { trials = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-n") == 0) { max_size = atol(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-s") == 0) { seed = atoi(argv[++i]); }
+        else
+        {
+            fprintf(stderr, "%s", bench_usage_string);
+            return 1;
+        }
+    }
+    if (trials < 1) trials = 1;
+
+    const size_t hull_sizes[] = { 0, 8, 64, 512 };
+    printf("algorithm,n,h,trials,median_ms,ns_per_point,hull_ok\n");
+    std::mt19937 rng(seed);
+    vector<Tuple*> points;
+    for (size_t n = 1000; n <= max_size; n *= 10)
+    {
+        for (unsigned int k = 0; k < sizeof(hull_sizes) / sizeof(hull_sizes[0]); k++)
+        {
+            size_t h = hull_sizes[k];
+            if (h > n) continue;
+            generate(points, n, h, rng);
+            PointSet set(points);
+            // The square's hull size is whatever monotone chain says it is
+            size_t expected = h ? h : monotoneChain(points).size();
+
+            for (unsigned int m = 0; m < sizeof(hull_modes) / sizeof(hull_modes[0]); m++)
+            {
+                const HullMode &mode = hull_modes[m];
+                if (mode.run == run_gift_wrap
+                    && (double) n * expected * expected > GIFT_WRAP_MAX_WORK)
+                    continue;
+                std::vector<double> ms;
+                bool ok = true;
+                for (int t = 0; t < trials; t++)
+                {
+                    std::chrono::steady_clock::time_point start =
+                        std::chrono::steady_clock::now();
+                    size_t found = mode.run(points, set);
+                    std::chrono::duration<double, std::milli> elapsed =
+                        std::chrono::steady_clock::now() - start;
+                    ms.push_back(elapsed.count());
+                    // Every algorithm closes the hull with its first point
+                    ok = ok && found == expected + 1;
+                }
+                std::sort(ms.begin(), ms.end());
+                double median = ms[trials / 2];
+                if (trials % 2 == 0)
+                    median = (median + ms[trials / 2 - 1]) / 2;
+                printf("%s,%lu,%lu,%d,%.3f,%.2f,%s\n", mode.name,
+                    (unsigned long) n, (unsigned long) expected, trials, median,
+                    median * 1e6 / n, ok ? "yes" : "NO");
+                fflush(stdout);
+            }
+        }
+    }
+    for (size_t i = 0; i < points.size(); i++) delete points[i];
+    return 0;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file bench_incremental.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Replays a stream of points in batches, keeping the hull up to
+ * date after every batch, with IncrementalHull and by rerunning
+ * DoGrahamScan on everything seen so far.
+ *
+ * The stream is random points, or the points of a file of "x y" lines in
+ * the order they appear. Prints one CSV row per method with the total
+ * time, the median and worst time per batch, and how many batches' hulls
+ * had a different number of points from the other method's. DoGrahamScan
+ * keeps repeated points and points in the middle of hull edges, so on
+ * inputs with those (such as small grids) the sizes are expected to
+ * differ; -c checks the incremental hull against monotoneChain instead.
+ *
+ * Built with -DHEADLESS, so that DoGrahamScan reports its hull to a
+ * stand-in for the SDL application.
+ */
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include "IncrementalHull.h"
+#include "HullEngine.h"
+#include "HullAlgorithms.h"
+
+const char *bench_usage_string =
+"Usage: bench_incremental [-n N] [-b BATCH] [-s SEED] [-c] [FILE]\n\
+    Replays N random points, or the points in FILE, in batches of BATCH,\n\
+    computing the hull after every batch, and prints CSV to stdout.\n\
+    -n N        number of random points (default: 100000)\n\
+    -b BATCH    points per batch (default: 1000)\n\
+    -s SEED     seed for the random points (default: 1)\n\
+    -c          also check every incremental hull against monotoneChain\n";
+
+/**
+ * @brief Timings of one method over the whole replay.
+ */
+struct ReplayResult
+{
+    std::vector<double> batch_us;
+    std::vector<size_t> hull_sizes;
+};
+
+/**
+ * @brief Prints one CSV row for a method. The total is the sum of the
+ * batch times, so it leaves out the -c checks.
+ */
+void report(const char *method, size_t n, size_t batch, ReplayResult &r,
+    size_t mismatches)
+{
+    std::vector<double> sorted(r.batch_us);
+    std::sort(sorted.begin(), sorted.end());
+    double total_us = 0;
+    for (size_t i = 0; i < sorted.size(); i++) total_us += sorted[i];
+    printf("%s,%lu,%lu,%lu,%.3f,%.1f,%.1f,%lu,%lu\n", method,
+        (unsigned long) n, (unsigned long) batch,
+        (unsigned long) sorted.size(), total_us / 1000, sorted[sorted.size() / 2],
+        sorted.back(), (unsigned long) r.hull_sizes.back(),
+        (unsigned long) mismatches);
+}
+
+/**
+ * @brief Checks that a snapshot has the same vertices as monotoneChain
+ * finds for the points so far.
+ */
+bool checkSnapshot(std::vector<Tuple> &stream, size_t seen,
+    const std::vector<Tuple> &hull)
+{
+    vector<Tuple*> pointers;
+    for (size_t i = 0; i < seen; i++) pointers.push_back(&stream[i]);
+    vector<Tuple*> expected = monotoneChain(pointers);
+    if (expected.size() != hull.size()) return false;
+    for (size_t i = 0; i < hull.size(); i++)
+    {
+        if (expected[i]->x != hull[i].x || expected[i]->y != hull[i].y)
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t n = 100000, batch = 1000;
+    unsigned int seed = 1;
+    bool check = false;
+    const char *filename = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *arg = argv[i];
+        if (i + 1 < argc && strcmp(arg, "-n") == 0) { n = atol(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-b") == 0) { batch = atol(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-s") == 0) { seed = atoi(argv[++i]); }
+        else if (strcmp(arg, "-c") == 0) { check = true; }
+        else if (arg[0] != '-' && filename == NULL) { filename = arg; }
+        else
+        {
+            fprintf(stderr, "%s", bench_usage_string);
+            return 1;
+        }
+    }
+    if (batch < 1) batch = 1;
+
+    std::vector<Tuple> stream;
+    if (filename != NULL)
+    {
+        if (!readPointFile(filename, stream))
+        {
+            fprintf(stderr, "Unable to open file!\n");
+            return 1;
+        }
+    }
+    else
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> coord(0, 1 << 20);
+        for (size_t i = 0; i < n; i++)
+            stream.push_back(Tuple(coord(rng), coord(rng)));
+    }
+    n = stream.size();
+    if (n < 3)
+    {
+        fprintf(stderr, "Need at least 3 points.\n");
+        return 1;
+    }
+
+    // Incremental: insert each batch, then take a snapshot
+    ReplayResult incremental;
+    IncrementalHull hull;
+    size_t check_failures = 0;
+    for (size_t first = 0; first < n; first += batch)
+    {
+        size_t count = std::min(batch, n - first);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        hull.insert(&stream[first], count);
+        std::vector<Tuple> snapshot = hull.snapshot();
+        std::chrono::duration<double, std::micro> elapsed =
+            std::chrono::steady_clock::now() - start;
+        incremental.batch_us.push_back(elapsed.count());
+        incremental.hull_sizes.push_back(snapshot.size());
+        if (check && !checkSnapshot(stream, first + count, snapshot))
+            check_failures++;
+    }
+    if (check)
+    {
+        fprintf(stderr, "check: %lu of %lu snapshots wrong\n",
+            (unsigned long) check_failures,
+            (unsigned long) incremental.hull_sizes.size());
+    }
+
+    // Recompute: rerun Graham scan over everything seen so far
+    ReplayResult graham;
+    vector<Tuple*> seen;
+    for (size_t first = 0; first < n; first += batch)
+    {
+        size_t count = std::min(batch, n - first);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (size_t i = first; i < first + count; i++) seen.push_back(&stream[i]);
+        ConvexHullApp app;
+        DoGrahamScan(seen, &app);
+        std::chrono::duration<double, std::micro> elapsed =
+            std::chrono::steady_clock::now() - start;
+        graham.batch_us.push_back(elapsed.count());
+        // DoGrahamScan closes the hull by adding its first point again
+        graham.hull_sizes.push_back(app.hull.empty() ? 0 : app.hull.size() - 1);
+    }
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < incremental.hull_sizes.size(); i++)
+    {
+        if (incremental.hull_sizes[i] != graham.hull_sizes[i]) mismatches++;
+    }
+    printf("method,points,batch,batches,total_ms,median_batch_us,"
+        "max_batch_us,final_hull,size_mismatches\n");
+    report("incremental", n, batch, incremental, mismatches);
+    report("graham-recompute", n, batch, graham, mismatches);
+    return check_failures > 0;
+}
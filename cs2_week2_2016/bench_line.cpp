@@ -0,0 +1,287 @@
+/**
+ * @file bench_line.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Benchmarks the batch line rasterizers against line().
+ *
+ * Draws random segments between points of a width x height frame, with
+ * line() (one vector of Tuples per segment, as LineApp uses it), with
+ * rasterize, rasterizeUnrolled and rasterizeSimd into a pixel buffer, and
+ * with rasterizeSpans into a span list. Prints one CSV row per method
+ * with the median time and the pixel rate. -l limits how long the
+ * segments are, for batches of many short ones, and -a how steep, for
+ * shallow or horizontal ones. -c first checks, on a
+ * small frame with segments sticking out of it, that every method draws
+ * exactly the pixels line() gives, one segment at a time and (for the
+ * pixel buffer methods) in batches.
+ *
+ * Built with -DHEADLESS, so that LineAlgorithm.h leaves out the SDL
+ * application.
+ */
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include "LineAlgorithm.h"
+
+const char *bench_usage_string =
+"Usage: bench_line [-n SEGMENTS] [-w WIDTH] [-h HEIGHT] [-l LENGTH] [-t TRIALS]\n\
+                  [-a SLOPE] [-s SEED] [-c]\n\
+    Draws random segments with each line rasterizer and prints CSV to stdout.\n\
+    -n SEGMENTS number of segments (default: 100000)\n\
+    -w WIDTH    frame width (default: 1920)\n\
+    -h HEIGHT   frame height (default: 1080)\n\
+    -l LENGTH   longest segment, in pixels along each axis (default: any)\n\
+    -a SLOPE    steepest segment, as rise over run; 0 draws only\n\
+                horizontal segments (default: any)\n\
+    -t TRIALS   trials per method (default: 5)\n\
+    -s SEED     seed for the segments (default: 1)\n\
+    -c          first check every method against line()\n";
+
+/**
+ * @brief Fills segments with n segments whose ends are uniform in
+ * [lo, hi) in both x and y, and (if length is not 0) no more than length
+ * apart in either. If slope is not negative, the rise of each segment is
+ * instead uniform in [-slope, slope] times its run, so 0 gives horizontal
+ * segments.
+ */
+void generate(vector<Segment> &segments, size_t n, int lo, int hiX, int hiY,
+    int length, double slope, std::mt19937 &rng)
+{
+    std::uniform_int_distribution<int> x(lo, hiX - 1), y(lo, hiY - 1);
+    std::uniform_int_distribution<int> step(-length, length);
+    segments.clear();
+    while (segments.size() < n)
+    {
+        int x0 = x(rng), y0 = y(rng);
+        int x1 = (length == 0) ? x(rng) : x0 + step(rng), y1;
+        if (slope < 0)
+        {
+            y1 = (length == 0) ? y(rng) : y0 + step(rng);
+        }
+        else
+        {
+            int rise = (int) (slope * abs(x1 - x0));
+            if (length != 0) rise = std::min(rise, length);
+            y1 = y0 + std::uniform_int_distribution<int>(-rise, rise)(rng);
+        }
+        if (x1 >= lo && y1 >= lo && x1 < hiX && y1 < hiY)
+            segments.push_back(Segment(x0, y0, x1, y1));
+    }
+}
+
+/**
+ * @brief Checks one batch method against line() one segment at a time:
+ * every pixel line() gives that is in the frame must be set, and no
+ * others (the method's count must match). Clears the frame as it goes.
+ *
+ * @return the number of segments drawn differently.
+ */
+size_t checkBuffer(size_t (*method)(const Segment*, size_t, PixelBuffer&, uint32_t),
+    const vector<Segment> &segments, PixelBuffer &frame)
+{
+    size_t wrong = 0;
+    for (size_t i = 0; i < segments.size(); i++)
+    {
+        const Segment &s = segments[i];
+        size_t drawn = method(&s, 1, frame, 1);
+        vector<Tuple> expected = line(Tuple(s.x0, s.y0), Tuple(s.x1, s.y1));
+        size_t found = 0;
+        for (size_t k = 0; k < expected.size(); k++)
+        {
+            int x = expected[k].x, y = expected[k].y;
+            if (x < 0 || y < 0 || x >= frame.width || y >= frame.height) continue;
+            uint32_t &pixel = frame.pixels[y * frame.stride + x];
+            if (pixel == 1) found++;
+            pixel = 0;
+        }
+        if (found != drawn) wrong++;
+        // Anything left over was drawn where line() does not go
+        if (found != drawn)
+            std::fill(frame.pixels, frame.pixels + frame.height * frame.stride, 0);
+    }
+    return wrong;
+}
+
+/**
+ * @brief Checks one batch method against line() on batches of 16
+ * segments: the frame it draws must be the same, pixel for pixel, as the
+ * one line()'s pixels make.
+ *
+ * @return the number of batches drawn differently.
+ */
+size_t checkBatches(size_t (*method)(const Segment*, size_t, PixelBuffer&, uint32_t),
+    const vector<Segment> &segments, PixelBuffer &frame)
+{
+    size_t wrong = 0;
+    vector<uint32_t> expected(frame.height * frame.stride, 0);
+    for (size_t first = 0; first < segments.size(); first += 16)
+    {
+        size_t count = std::min((size_t) 16, segments.size() - first);
+        std::fill(frame.pixels, frame.pixels + frame.height * frame.stride, 0);
+        std::fill(expected.begin(), expected.end(), 0);
+        method(&segments[first], count, frame, 1);
+        for (size_t i = first; i < first + count; i++)
+        {
+            const Segment &s = segments[i];
+            vector<Tuple> pixels = line(Tuple(s.x0, s.y0), Tuple(s.x1, s.y1));
+            for (size_t k = 0; k < pixels.size(); k++)
+            {
+                int x = pixels[k].x, y = pixels[k].y;
+                if (x >= 0 && y >= 0 && x < frame.width && y < frame.height)
+                    expected[y * frame.stride + x] = 1;
+            }
+        }
+        if (!std::equal(expected.begin(), expected.end(), frame.pixels)) wrong++;
+    }
+    std::fill(frame.pixels, frame.pixels + frame.height * frame.stride, 0);
+    return wrong;
+}
+
+/**
+ * @brief Checks rasterizeSpans against line(), pixel by pixel in order.
+ *
+ * @return the number of segments drawn differently.
+ */
+size_t checkSpans(const vector<Segment> &segments)
+{
+    size_t wrong = 0;
+    vector<Span> spans;
+    for (size_t i = 0; i < segments.size(); i++)
+    {
+        const Segment &s = segments[i];
+        spans.clear();
+        rasterizeSpans(&s, 1, spans);
+        vector<Tuple> expected = line(Tuple(s.x0, s.y0), Tuple(s.x1, s.y1));
+        // Spans run left to right, the line from its first end; both
+        // visit the rows in the same order
+        size_t k = 0;
+        bool ok = true;
+        for (size_t j = 0; ok && j < spans.size(); j++)
+        {
+            size_t width = spans[j].x1 - spans[j].x0 + 1;
+            for (size_t m = 0; ok && m < width; m++, k++)
+            {
+                ok = k < expected.size() && expected[k].y == spans[j].y
+                    && expected[k].x >= spans[j].x0 && expected[k].x <= spans[j].x1;
+            }
+        }
+        if (!ok || k != expected.size()) wrong++;
+    }
+    return wrong;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t n = 100000;
+    int width = 1920, height = 1080, length = 0, trials = 5;
+    unsigned int seed = 1;
+    double slope = -1;
+    bool check = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *arg = argv[i];
+        if (i + 1 < argc && strcmp(arg, "-n") == 0) { n = atol(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-w") == 0) { width = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-h") == 0) { height = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-l") == 0) { length = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-a") == 0) { slope = atof(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-t") == 0) { trials = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-s") == 0) { seed = atoi(argv[++i]); }
+        else if (strcmp(arg, "-c") == 0) { check = true; }
+        else
+        {
+            fprintf(stderr, "%s", bench_usage_string);
+            return 1;
+        }
+    }
+    if (trials < 1) trials = 1;
+    if (width < 1 || height < 1 || length < 0)
+    {
+        fprintf(stderr, "%s", bench_usage_string);
+        return 1;
+    }
+
+    std::mt19937 rng(seed);
+    vector<Segment> segments;
+    size_t failures = 0;
+    if (check)
+    {
+        // A 256 x 200 frame in a 300-pixel stride, with ends up to 100
+        // pixels outside it, and a batch of very short segments
+        vector<uint32_t> small(200 * 300, 0);
+        PixelBuffer frame(&small[0], 256, 200, 300);
+        generate(segments, 20000, -100, 356, 300, 0, -1, rng);
+        vector<Segment> shortSegments;
+        generate(shortSegments, 20000, 0, 6, 6, 0, -1, rng);
+        segments.insert(segments.end(), shortSegments.begin(), shortSegments.end());
+        generate(shortSegments, 20000, -10, 266, 210, 12, -1, rng);
+        segments.insert(segments.end(), shortSegments.begin(), shortSegments.end());
+
+        size_t wrong[4] = { checkBuffer(rasterize, segments, frame),
+            checkBuffer(rasterizeUnrolled, segments, frame),
+            checkBuffer(rasterizeSimd, segments, frame), checkSpans(segments) };
+        size_t wrongBatches[3] = { checkBatches(rasterize, segments, frame),
+            checkBatches(rasterizeUnrolled, segments, frame),
+            checkBatches(rasterizeSimd, segments, frame) };
+        fprintf(stderr, "check: %lu segments; wrong: rasterize %lu, "
+            "unrolled %lu, simd %lu, spans %lu; batches of 16 wrong: "
+            "rasterize %lu, unrolled %lu, simd %lu\n",
+            (unsigned long) segments.size(), (unsigned long) wrong[0],
+            (unsigned long) wrong[1], (unsigned long) wrong[2],
+            (unsigned long) wrong[3], (unsigned long) wrongBatches[0],
+            (unsigned long) wrongBatches[1], (unsigned long) wrongBatches[2]);
+        for (int k = 0; k < 4; k++) failures += wrong[k];
+        for (int k = 0; k < 3; k++) failures += wrongBatches[k];
+    }
+
+    generate(segments, n, 0, width, height, length, slope, rng);
+    vector<uint32_t> pixels((size_t) width * height, 0);
+    PixelBuffer frame(&pixels[0], width, height, width);
+    vector<Span> spans;
+
+    printf("method,segments,pixels,trials,median_ms,mpixels_per_s\n");
+    const char *methods[] = { "line", "rasterize", "unrolled", "simd", "spans" };
+    for (int m = 0; m < 5; m++)
+    {
+        std::vector<double> ms;
+        size_t total = 0;
+        for (int t = 0; t < trials; t++)
+        {
+            std::chrono::steady_clock::time_point start =
+                std::chrono::steady_clock::now();
+            total = 0;
+            if (m == 0)
+            {
+                for (size_t i = 0; i < n; i++)
+                {
+                    const Segment &s = segments[i];
+                    total += line(Tuple(s.x0, s.y0), Tuple(s.x1, s.y1)).size();
+                }
+            }
+            else if (m == 1) { total = rasterize(&segments[0], n, frame, t + 1); }
+            else if (m == 2) { total = rasterizeUnrolled(&segments[0], n, frame, t + 1); }
+            else if (m == 3) { total = rasterizeSimd(&segments[0], n, frame, t + 1); }
+            else
+            {
+                spans.clear();
+                rasterizeSpans(&segments[0], n, spans);
+                for (size_t i = 0; i < spans.size(); i++)
+                    total += spans[i].x1 - spans[i].x0 + 1;
+            }
+            std::chrono::duration<double, std::milli> elapsed =
+                std::chrono::steady_clock::now() - start;
+            ms.push_back(elapsed.count());
+        }
+        std::sort(ms.begin(), ms.end());
+        double median = ms[trials / 2];
+        printf("%s,%lu,%lu,%d,%.3f,%.1f\n", methods[m], (unsigned long) n,
+            (unsigned long) total, trials, median, total / median / 1e3);
+        fflush(stdout);
+    }
+    return failures > 0;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file bench_list.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Benchmarks inserting integers into List against the version it
+ * replaced.
+ *
+ * For sizes from 1e3 up to 1e7, builds a list of that many integers and
+ * destroys it again, and prints one CSV row per (version, size): the
+ * median time per insert (counting the destructor too), and how much the
+ * peak resident set size rose while the list was built (the largest rise
+ * over the trials).
+ *
+ * The versions are:
+ * - arena: List, with its tail pointer and slabs of nodes.
+ * - tail: the old List with just a tail pointer added, which separates
+ *   what the tail pointer saves from what the arena does.
+ * - walk: the old List, which walks from the head to the tail on every
+ *   insert and allocates every node on its own. It takes O(n^2) time, so
+ *   it is capped (see -w).
+ */
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include "bench_util.h"
+#include "linked_list.h"
+
+/**
+ * @brief The List this replaced: every insert walks the whole list, and
+ * every node is a separate new.
+ */
+class WalkingList
+{
+public:
+    WalkingList() : head(NULL), num_elements(0) { }
+
+    ~WalkingList()
+    {
+        Node *nxt = head;
+        while (nxt != NULL)
+        {
+            Node *toDel = nxt;
+            nxt = nxt->next;
+            delete toDel;
+        }
+    }
+
+    void insert(int item)
+    {
+        if (num_elements > 0)
+        {
+            Node *temp = head;
+            for (int i = 0; i < num_elements - 1; ++i) temp = temp->next;
+            temp->next = new Node(item, NULL);
+        }
+        else
+        {
+            head = new Node(item, NULL);
+        }
+        num_elements++;
+    }
+
+private:
+    struct Node
+    {
+        int data;
+        Node *next;
+        Node(int data, Node *next) : data(data), next(next) { }
+    };
+    Node *head;
+    int num_elements;
+};
+
+/**
+ * @brief The old List with a tail pointer, but still one new per node.
+ */
+class TailList
+{
+public:
+    TailList() : head(NULL), tail(NULL) { }
+
+    ~TailList()
+    {
+        Node *nxt = head;
+        while (nxt != NULL)
+        {
+            Node *toDel = nxt;
+            nxt = nxt->next;
+            delete toDel;
+        }
+    }
+
+    void insert(int item)
+    {
+        Node *new_node = new Node(item, NULL);
+        if (tail != NULL) tail->next = new_node;
+        else head = new_node;
+        tail = new_node;
+    }
+
+private:
+    struct Node
+    {
+        int data;
+        Node *next;
+        Node(int data, Node *next) : data(data), next(next) { }
+    };
+    Node *head;
+    Node *tail;
+};
+
+const char *bench_usage_string =
+"Usage: bench_list [-t TRIALS] [-n MAX_SIZE] [-w WALK_MAX]\n\
+    Benchmarks inserting into linked lists and prints CSV to stdout.\n\
+    -t TRIALS   trials per version and size (default: 3)\n\
+    -n MAX_SIZE largest list; sizes go up by 10x from 1000\n\
+                (default: 10000000)\n\
+    -w WALK_MAX largest list for the old, O(n^2) version (default: 10000)\n";
+
+/**
+ * @brief Builds a list of n integers and destroys it. Sets ms to the time
+ * that took, and returns how much the peak RSS rose, in kilobytes.
+ */
+template <class ListType>
+long build(size_t n, double &ms)
+{
+    reset_peak_rss();
+    long before = read_rss_kb(false);
+    long rise;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ListType *list = new ListType();
+    for (size_t i = 0; i < n; i++) list->insert((int) i);
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    rise = read_rss_kb(true) - before;
+    start = std::chrono::steady_clock::now();
+    delete list;
+    elapsed += std::chrono::steady_clock::now() - start;
+    ms = elapsed.count();
+    return rise;
+}
+
+/**
+ * @brief One version of the list: its name, the function that builds it,
+ * and whether it is the O(n^2) one.
+ */
+struct ListVersion
+{
+    const char *name;
+    long (*build)(size_t n, double &ms);
+    bool quadratic;
+};
+
+const ListVersion versions[] =
+{
+    { "arena", build<List>,        false },
+    { "tail",  build<TailList>,    false },
+    { "walk",  build<WalkingList>, true },
+};
+
+int main(int argc, char *argv[])
+{
+    int trials = 3;
+    size_t max_size = 10000000, walk_max = 10000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *arg = argv[i];
+        if (i + 1 < argc && strcmp(arg, "-t") == 0) { trials = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-n") == 0) { max_size = atol(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-w") == 0) { walk_max = atol(argv[++i]); }
+        else
+        {
+            fprintf(stderr, "%s", bench_usage_string);
+            return 1;
+        }
+    }
+    if (trials < 1) trials = 1;
+
+    printf("version,n,trials,median_ms,ns_per_insert,rss_rise_kb\n");
+    for (size_t n = 1000; n <= max_size; n *= 10)
+    {
+        for (unsigned int v = 0; v < sizeof(versions) / sizeof(versions[0]); v++)
+        {
+            const ListVersion &version = versions[v];
+            if (version.quadratic && n > walk_max) continue;
+            std::vector<double> ms;
+            long rss = 0;
+            for (int t = 0; t < trials; t++)
+            {
+                double trial_ms;
+                rss = std::max(rss, version.build(n, trial_ms));
+                ms.push_back(trial_ms);
+            }
+            std::sort(ms.begin(), ms.end());
+            double median = ms[trials / 2];
+            printf("%s,%lu,%d,%.3f,%.2f,%ld\n", version.name, (unsigned long) n,
+                trials, median, median * 1e6 / n, rss);
+            fflush(stdout);
+        }
+    }
+    return 0;
+}
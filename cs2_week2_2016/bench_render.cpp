@@ -0,0 +1,182 @@
+/**
+ * @file bench_render.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Renders a large batch of short segments with LineRenderer, and
+ * writes the frame to a PPM file.
+ *
+ * The segments are random polylines, like the roads of a vector map: each
+ * one starts where the last ended, unless it would leave the frame.
+ * Prints one CSV row for drawing the batch on one thread with rasterize
+ * (or rasterizeWu, with -a), and one for the tiled renderer, with their
+ * median times. -c checks that the renderer's frame is the same as the
+ * one-thread frame, pixel for pixel.
+ *
+ * Built with -DHEADLESS, so it needs neither SDL nor a display.
+ */
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include "LineRenderer.h"
+
+const char *bench_usage_string =
+"Usage: bench_render [-n SEGMENTS] [-w WIDTH] [-h HEIGHT] [-l LENGTH] [-j THREADS]\n\
+                    [-t TRIALS] [-s SEED] [-a] [-c] [-o FILE]\n\
+    Renders random polylines and prints CSV to stdout.\n\
+    -n SEGMENTS number of segments (default: 1000000)\n\
+    -w WIDTH    frame width (default: 1920)\n\
+    -h HEIGHT   frame height (default: 1080)\n\
+    -l LENGTH   longest segment, in pixels along each axis (default: 24)\n\
+    -j THREADS  renderer threads, 0 for one per core (default: 0)\n\
+    -t TRIALS   trials per method (default: 5)\n\
+    -s SEED     seed for the segments (default: 1)\n\
+    -a          anti-alias with Wu's algorithm\n\
+    -c          check the renderer against drawing on one thread\n\
+    -o FILE     write the rendered frame to FILE as a PPM image\n";
+
+/**
+ * @brief Fills segments with n segments of random polylines in a
+ * width x height frame.
+ */
+void generate(vector<Segment> &segments, size_t n, int width, int height,
+    int length, std::mt19937 &rng)
+{
+    std::uniform_int_distribution<int> step(-length, length);
+    std::uniform_int_distribution<int> x(0, width - 1), y(0, height - 1);
+    segments.clear();
+    int px = x(rng), py = y(rng);
+    while (segments.size() < n)
+    {
+        int nx = px + step(rng), ny = py + step(rng);
+        if (nx < 0 || ny < 0 || nx >= width || ny >= height)
+        {
+            // Start a new polyline
+            px = x(rng);
+            py = y(rng);
+            continue;
+        }
+        segments.push_back(Segment(px, py, nx, ny));
+        px = nx;
+        py = ny;
+    }
+}
+
+/**
+ * @brief Prints the median of ms as a CSV row.
+ */
+void report(const char *method, int threads, size_t n, size_t pixels,
+    std::vector<double> &ms)
+{
+    std::sort(ms.begin(), ms.end());
+    double median = ms[ms.size() / 2];
+    printf("%s,%d,%lu,%lu,%lu,%.3f,%.1f,%.1f\n", method, threads,
+        (unsigned long) n, (unsigned long) pixels, (unsigned long) ms.size(),
+        median, n / median / 1e3, pixels / median / 1e3);
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    size_t n = 1000000;
+    int width = 1920, height = 1080, length = 24, nthreads = 0, trials = 5;
+    unsigned int seed = 1;
+    bool antialias = false, check = false;
+    const char *filename = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *arg = argv[i];
+        if (i + 1 < argc && strcmp(arg, "-n") == 0) { n = atol(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-w") == 0) { width = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-h") == 0) { height = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-l") == 0) { length = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-j") == 0) { nthreads = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-t") == 0) { trials = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-s") == 0) { seed = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-o") == 0) { filename = argv[++i]; }
+        else if (strcmp(arg, "-a") == 0) { antialias = true; }
+        else if (strcmp(arg, "-c") == 0) { check = true; }
+        else
+        {
+            fprintf(stderr, "%s", bench_usage_string);
+            return 1;
+        }
+    }
+    if (trials < 1) trials = 1;
+    if (width < 1 || height < 1 || length < 1)
+    {
+        fprintf(stderr, "%s", bench_usage_string);
+        return 1;
+    }
+
+    std::mt19937 rng(seed);
+    vector<Segment> segments;
+    generate(segments, n, width, height, length, rng);
+    // Dark blue background, and a color for each trial so that they do
+    // not just redraw the same pixels
+    const uint32_t background = 0x101830;
+    const uint32_t colors[] = { 0xffd040, 0x40ff80, 0xff6060, 0x60c0ff };
+
+    printf("method,threads,segments,pixels,trials,median_ms,"
+        "msegments_per_s,mpixels_per_s\n");
+
+    // One thread, over the whole frame
+    vector<uint32_t> serialPixels((size_t) width * height);
+    PixelBuffer serial(serialPixels.data(), width, height, width);
+    std::vector<double> ms;
+    size_t pixels = 0;
+    for (int t = 0; t < trials; t++)
+    {
+        std::fill(serialPixels.begin(), serialPixels.end(), background);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        uint32_t color = colors[t % 4];
+        pixels = antialias ? rasterizeWu(segments.data(), n, serial, color)
+            : rasterize(segments.data(), n, serial, color);
+        std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+        ms.push_back(elapsed.count());
+    }
+    report(antialias ? "rasterizeWu" : "rasterize", 1, n, pixels, ms);
+
+    // The tiled renderer, including the time to bin the segments
+    LineRenderer renderer(width, height, nthreads);
+    ms.clear();
+    for (int t = 0; t < trials; t++)
+    {
+        renderer.clear(background);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        pixels = renderer.draw(segments.data(), n, colors[t % 4], antialias);
+        std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+        ms.push_back(elapsed.count());
+    }
+    report(antialias ? "tiled-wu" : "tiled", renderer.threads(), n, pixels, ms);
+
+    int status = 0;
+    if (check)
+    {
+        // Both frames hold the last trial's color
+        PixelBuffer &frame = renderer.buffer();
+        size_t wrong = 0;
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                if (frame.pixels[y * frame.stride + x] != serialPixels[y * width + x])
+                    wrong++;
+            }
+        }
+        fprintf(stderr, "check: %lu of %lu pixels differ\n",
+            (unsigned long) wrong, (unsigned long) serialPixels.size());
+        if (wrong > 0) status = 1;
+    }
+    if (filename != NULL && !renderer.writePPM(filename))
+    {
+        fprintf(stderr, "Unable to write %s!\n", filename);
+        status = 1;
+    }
+    return status;
+}
@@ -0,0 +1,302 @@
+/**
+ * @file bench_sort.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Benchmark harness for the sorter modes.
+ *
+ * Generates inputs in-process (random, sorted, reverse, organ-pipe,
+ * few-unique and Zipf) at sizes from 1e3 up to 1e8, runs every in-memory
+ * sorter mode on each of them several times, and prints one CSV row per
+ * (mode, distribution, size): the median time per element, the heap
+ * allocations made by one sort, and the peak resident set size during it.
+ * Every result is also checked to be sorted.
+ *
+ * The external sort (-x) is not included since it sorts files rather than
+ * vectors; it is the radix sort (-r) plus disk I/O.
+ */
+#include <new>
+#include <random>
+#include "bench_util.h"
+#include "sorter.h"
+
+/**
+ * @brief Heap allocations made through operator new, counted for the
+ * current trial.
+ */
+static std::atomic<size_t> alloc_count(0);
+static std::atomic<size_t> alloc_bytes(0);
+
+void *operator new(size_t size)
+{
+    alloc_count++;
+    alloc_bytes += size;
+    void *p = malloc(size ? size : 1);
+    if (p == NULL) throw std::bad_alloc();
+    return p;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept
+{
+    free(p);
+}
+
+/**
+ * @brief The input distributions.
+ */
+enum Distribution
+{
+    RANDOM, SORTED, REVERSE, ORGAN_PIPE, FEW_UNIQUE, ZIPF, NUM_DISTRIBUTIONS
+};
+
+const char *distribution_names[NUM_DISTRIBUTIONS] =
+{
+    "random", "sorted", "reverse", "organ-pipe", "few-unique", "zipf"
+};
+
+/**
+ * @brief One sorter mode: its command-line flag, how to run it, and the
+ * largest input it is given.
+ *
+ * bubbleSort is quadratic, and quickSort and mergeSort allocate on every
+ * level of recursion, so they are capped well below the faster modes.
+ * quickSort also degrades towards quadratic time and memory on anything
+ * but random input (duplicates all go to one side of the pivot, and
+ * organ-pipe input defeats the middle pivot), so it has a separate, much
+ * lower cap for the other distributions.
+ */
+struct SortMode
+{
+    const char *flag;
+    void (*run)(std::vector<int> &list, int nthreads);
+    size_t max_n_random;
+    size_t max_n_other;
+};
+
+static void run_bubble(std::vector<int> &list, int)
+{
+    bubbleSort(list);
+}
+
+static void run_quick(std::vector<int> &list, int)
+{
+    list = quickSort(list);
+}
+
+static void run_merge(std::vector<int> &list, int)
+{
+    list = mergeSort(list);
+}
+
+static void run_merge_buffered(std::vector<int> &list, int)
+{
+    mergeSortBuffered(list);
+}
+
+static void run_quick_inplace(std::vector<int> &list, int)
+{
+    quicksort_inplace(list, 0, list.size() - 1);
+}
+
+static void run_quick_3way(std::vector<int> &list, int)
+{
+    quicksort_3way(list, 0, list.size() - 1);
+}
+
+static void run_quick_parallel(std::vector<int> &list, int nthreads)
+{
+    quicksort_parallel(list, nthreads);
+}
+
+static void run_radix(std::vector<int> &list, int nthreads)
+{
+    radixSort(list, nthreads);
+}
+
+static void run_std_sort(std::vector<int> &list, int)
+{
+    std::sort(list.begin(), list.end());
+}
+
+const SortMode modes[] =
+{
+    { "-b",  run_bubble,         10000,     10000 },
+    { "-q",  run_quick,          1000000,   10000 },
+    { "-m",  run_merge,          10000000,  10000000 },
+    { "-m2", run_merge_buffered, 100000000, 100000000 },
+    { "-qi", run_quick_inplace,  100000000, 100000000 },
+    { "-q3", run_quick_3way,     100000000, 100000000 },
+    { "-qp", run_quick_parallel, 100000000, 100000000 },
+    { "-r",  run_radix,          100000000, 100000000 },
+    // Not a sorter mode: the standard library's sort, as a yardstick for
+    // the introsort in sortlib.h behind -qi and -q3
+    { "std::sort", run_std_sort, 100000000, 100000000 },
+};
+
+const char *bench_usage_string =
+"Usage: bench_sort [-t TRIALS] [-n MAX_SIZE] [-j N] [-s SEED]\n\
+    Benchmarks every in-memory sorter mode and prints CSV to stdout.\n\
+    -t TRIALS   trials per mode, distribution and size (default: 5)\n\
+    -n MAX_SIZE largest input size; sizes go up by 10x from 1000\n\
+                (default: 100000000)\n\
+    -j N        threads for -qp and -r (default: one per core)\n\
+    -s SEED     seed for the input generator (default: 1)\n";
+
+/**
+ * @brief Fills list with n integers drawn from distribution d.
+ */
+void generate(std::vector<int> &list, size_t n, Distribution d,
+    std::mt19937 &rng)
+{
+    list.resize(n);
+    switch (d)
+    {
+        case RANDOM:
+        for (size_t i = 0; i < n; i++) list[i] = (int) rng();
+        break;
+
+        case SORTED:
+        for (size_t i = 0; i < n; i++) list[i] = (int) i;
+        break;
+
+        case REVERSE:
+        for (size_t i = 0; i < n; i++) list[i] = (int) (n - i);
+        break;
+
+        case ORGAN_PIPE:
+        // Rises to the middle, then falls back down
+        for (size_t i = 0; i < n; i++) list[i] = (int) (i < n / 2 ? i : n - i);
+        break;
+
+        case FEW_UNIQUE:
+        for (size_t i = 0; i < n; i++) list[i] = (int) (rng() % 16);
+        break;
+
+        case ZIPF:
+        {
+            // Value k (k >= 1) comes up with probability proportional to
+            // 1/k, over at most 2^20 distinct values; sample by binary
+            // search in the cumulative weights
+            size_t k = std::min(n, (size_t) 1 << 20);
+            std::vector<double> cumulative(k);
+            double total = 0;
+            for (size_t i = 0; i < k; i++) {
+                total += 1.0 / (i + 1);
+                cumulative[i] = total;
+            }
+            std::uniform_real_distribution<double> uniform(0, total);
+            for (size_t i = 0; i < n; i++) {
+                double u = uniform(rng);
+                list[i] = (int) (std::lower_bound(cumulative.begin(),
+                    cumulative.end(), u) - cumulative.begin()) + 1;
+            }
+            break;
+        }
+
+        default:
+        break;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int trials = 5;
+    size_t max_size = 100000000;
+    int nthreads = std::thread::hardware_concurrency();
+    unsigned int seed = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *arg = argv[i];
+        if (i + 1 < argc && strcmp(arg, "-t") == 0) { trials = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-n") == 0) { max_size = atol(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-j") == 0) { nthreads = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-s") == 0) { seed = atoi(argv[++i]); }
+        else
+        {
+            fprintf(stderr, "%s", bench_usage_string);
+            return 1;
+        }
+    }
+    if (trials < 1) trials = 1;
+    if (nthreads < 1) nthreads = 1;
+
+    printf("mode,distribution,n,trials,median_ns_per_element,allocations,"
+        "allocated_bytes,peak_rss_kb,sorted\n");
+    std::mt19937 rng(seed);
+    std::vector<int> input, work, reference;
+    for (size_t n = 1000; n <= max_size; n *= 10)
+    {
+        for (int d = 0; d < NUM_DISTRIBUTIONS; d++)
+        {
+            generate(input, n, (Distribution) d, rng);
+            reference = input;
+            std::sort(reference.begin(), reference.end());
+
+            for (unsigned int m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+            {
+                const SortMode &mode = modes[m];
+                if (n > (d == RANDOM ? mode.max_n_random : mode.max_n_other))
+                    continue;
+                std::vector<double> ns_per_element;
+                size_t allocs = 0, bytes = 0;
+                long rss = 0;
+                bool sorted = true;
+                for (int t = 0; t < trials; t++)
+                {
+                    // Copy the input outside of the timed region, and
+                    // release the previous trial's memory before the peak
+                    // RSS is reset
+                    std::vector<int>().swap(work);
+                    work = input;
+                    reset_peak_rss();
+                    alloc_count = 0;
+                    alloc_bytes = 0;
+
+                    std::chrono::steady_clock::time_point start =
+                        std::chrono::steady_clock::now();
+                    mode.run(work, nthreads);
+                    std::chrono::duration<double, std::nano> elapsed =
+                        std::chrono::steady_clock::now() - start;
+
+                    allocs = alloc_count;
+                    bytes = alloc_bytes;
+                    rss = std::max(rss, read_rss_kb(true));
+                    ns_per_element.push_back(elapsed.count() / n);
+                    sorted = sorted && (work == reference);
+                }
+                std::sort(ns_per_element.begin(), ns_per_element.end());
+                double median = ns_per_element[trials / 2];
+                if (trials % 2 == 0)
+                    median = (median + ns_per_element[trials / 2 - 1]) / 2;
+                printf("%s,%s,%lu,%d,%.3f,%lu,%lu,%ld,%s\n", mode.flag,
+                    distribution_names[d], (unsigned long) n, trials, median,
+                    (unsigned long) allocs, (unsigned long) bytes, rss,
+                    sorted ? "yes" : "NO");
+                fflush(stdout);
+            }
+        }
+    }
+    return 0;
+}
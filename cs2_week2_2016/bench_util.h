@@ -0,0 +1,59 @@
+/**
+ * @file bench_util.h
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Memory measurements shared by the benchmarks (header file).
+ */
+
+#ifndef __BENCH_UTIL_H__
+#define __BENCH_UTIL_H__
+
+#include <cstdio>
+#include <sys/resource.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+/**
+ * @brief Resets the kernel's record of this process's peak RSS, so that
+ * the next read_rss_kb(true) covers only what happened since.
+ */
+inline void reset_peak_rss()
+{
+#ifdef __GLIBC__
+    // Hand freed memory back first, or it counts towards the new peak
+    malloc_trim(0);
+#endif
+    FILE *f = fopen("/proc/self/clear_refs", "w");
+    if (f == NULL) return;
+    fputs("5", f);
+    fclose(f);
+}
+
+/**
+ * @brief Returns the peak resident set size in kilobytes (since the last
+ * reset_peak_rss() where the kernel supports it, else since startup), or
+ * the current one if peak is false. Returns -1 if neither can be read.
+ */
+inline long read_rss_kb(bool peak)
+{
+    FILE *f = fopen("/proc/self/status", "r");
+    if (f != NULL) {
+        char line[256];
+        long kb = -1;
+        const char *format = peak ? "VmHWM: %ld kB" : "VmRSS: %ld kB";
+        while (fgets(line, sizeof(line), f) != NULL) {
+            if (sscanf(line, format, &kb) == 1) break;
+        }
+        fclose(f);
+        if (kb >= 0) return kb;
+    }
+    if (!peak) return -1;
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+#endif
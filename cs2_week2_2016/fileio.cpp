@@ -10,6 +10,160 @@
 
 #include "fileio.h"
 
+/**
+ * @brief Reads the integers in stream and appends them to nums, one per line.
+ *
+ * This is the slow path, used when the input cannot be memory-mapped (pipes,
+ * terminals, and so on).
+ */
+static void readStream(istream &in, std::vector<int> &nums)
+{
+	// To store each line of the file
+    string num;
+    while (getline(in, num)) {
+		// Convert the line to an integer and add it to the vector
+		nums.push_back(atoi(num.c_str()));
+	}
+}
+
+/**
+ * @brief Checks whether the 8 bytes at p are all ASCII digits.
+ *
+ * Adding 6 to a digit byte leaves its high nibble at 3, while any other byte
+ * either starts or ends with a high nibble other than 3.
+ */
+static inline bool isEightDigits(uint64_t v)
+{
+    return ((v & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))
+        == 0x3333333333333333ULL;
+}
+
+/**
+ * @brief Converts 8 ASCII digits (loaded little-endian) to their value with
+ * three multiplies instead of eight dependent multiply-adds.
+ */
+static inline uint32_t parseEightDigits(uint64_t v)
+{
+    v -= 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);
+    v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+         (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return (uint32_t) v;
+}
+
+/**
+ * @brief Counts the lines in [begin, end): one per newline, plus one for an
+ * unterminated last line, matching what getline would return.
+ */
+static size_t countLines(const char *begin, const char *end)
+{
+    size_t lines = 0;
+    const char *p = begin;
+    // memchr is vectorized by the C library, so this runs at memory speed
+    while ((p = (const char *) memchr(p, '\n', end - p)) != NULL) {
+        lines++;
+        p++;
+    }
+    if (begin < end && end[-1] != '\n') lines++;
+    return lines;
+}
+
+/**
+ * @brief Parses every line in [p, end) with the same rules as atoi and writes
+ * one integer per line to out.
+ *
+ * Leading whitespace and a sign are skipped, digits are consumed eight at a
+ * time while possible, and anything after the digits is ignored up to the
+ * newline. An empty or non-numeric line becomes 0, just like atoi("").
+ */
+static void parseLines(const char *p, const char *end, int *out)
+{
+    while (p < end) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' ||
+                           *p == '\v' || *p == '\f')) p++;
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative = (*p == '-');
+            p++;
+        }
+        // Accumulate unsigned so that out-of-range input wraps instead of
+        // invoking undefined behavior
+        uint32_t val = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        uint64_t word;
+        while (end - p >= 8 && (memcpy(&word, p, 8), isEightDigits(word))) {
+            val = val * 100000000u + parseEightDigits(word);
+            p += 8;
+        }
+#endif
+        while (p < end && (unsigned) (*p - '0') < 10) {
+            val = val * 10 + (unsigned) (*p - '0');
+            p++;
+        }
+        *out++ = (int) (negative ? 0u - val : val);
+        // Skip whatever is left of the line
+        const char *nl = (const char *) memchr(p, '\n', end - p);
+        p = nl ? nl + 1 : end;
+    }
+}
+
+/**
+ * @brief Parses the integers in data, one per line, and appends them to nums.
+ *
+ * @param data: Text of the integers, one per line.
+ * @param size: Length of data in bytes.
+ * @param nums: Vector to append the integers to.
+ *
+ * The text is split into newline-aligned chunks, one per hardware thread.
+ * Each chunk is parsed twice: once to count its lines, so that nums can be
+ * grown exactly once, and once to parse its integers straight into their
+ * final slot in nums.
+ */
+void parseBuffer(const char *data, size_t size, std::vector<int> &nums)
+{
+    // Only split the text when every thread gets a worthwhile amount of work
+    size_t nthreads = thread::hardware_concurrency();
+    if (nthreads == 0) nthreads = 1;
+    if (nthreads > size / READ_CHUNK_BYTES) nthreads = size / READ_CHUNK_BYTES;
+    if (nthreads == 0) nthreads = 1;
+
+    // Chunk t is [bounds[t], bounds[t + 1]); every boundary but the first is
+    // moved just past a newline so that no line straddles two chunks
+    vector<const char *> bounds(nthreads + 1);
+    bounds[0] = data;
+    bounds[nthreads] = data + size;
+    for (size_t t = 1; t < nthreads; t++) {
+        const char *b = data + size * t / nthreads;
+        if (b < bounds[t - 1]) b = bounds[t - 1];
+        const char *nl = (const char *) memchr(b, '\n', data + size - b);
+        bounds[t] = nl ? nl + 1 : data + size;
+    }
+
+    // Pass 1: count lines per chunk so that every chunk knows its offset
+    vector<size_t> offsets(nthreads + 1, 0);
+    vector<thread> workers;
+    for (size_t t = 0; t < nthreads; t++) {
+        workers.push_back(thread([&bounds, &offsets, t]() {
+            offsets[t + 1] = countLines(bounds[t], bounds[t + 1]);
+        }));
+    }
+    for (size_t t = 0; t < nthreads; t++) workers[t].join();
+    workers.clear();
+    offsets[0] = nums.size();
+    for (size_t t = 0; t < nthreads; t++) offsets[t + 1] += offsets[t];
+
+    // Pass 2: grow nums once and parse every chunk into its own slice
+    nums.resize(offsets[nthreads]);
+    int *out = nums.data();
+    for (size_t t = 0; t < nthreads; t++) {
+        workers.push_back(thread([&bounds, &offsets, out, t]() {
+            parseLines(bounds[t], bounds[t + 1], out + offsets[t]);
+        }));
+    }
+    for (size_t t = 0; t < nthreads; t++) workers[t].join();
+}
+
 /**
  * @brief Reads the integers in file and fills nums with these integers.
  *
@@ -18,22 +172,247 @@
  *
  * Notice that the vector is passed by reference, so you should fill the vector
  * and not return anything from this function.
+ *
+ * Regular files are memory-mapped and handed to parseBuffer. Anything that
+ * cannot be mapped falls back to reading line by line.
  */
 void readFile(char const *file, std::vector<int> &nums)
 {
-	// To store each line of the file
-    string num;
-    // Open the file for input
-    fstream myfile;
-    myfile.open(file);
-    // Check if the file is open
-    if (myfile.is_open()) {
-		while (getline(myfile, num)){
-			// Convert the line to an integer and add it to the vector
-			nums.push_back(atoi(num.c_str()));
-		}
-		myfile.close();
-	}
-	else cout << "Unable to open file!";
+    int fd = open(file, O_RDONLY);
+    if (fd < 0) {
+        cout << "Unable to open file!";
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        ifstream myfile(file);
+        readStream(myfile, nums);
+        return;
+    }
+    size_t size = st.st_size;
+    if (size == 0) {
+        close(fd);
+        return;
+    }
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        ifstream myfile(file);
+        readStream(myfile, nums);
+        return;
+    }
+    madvise(map, size, MADV_SEQUENTIAL);
+    parseBuffer((const char *) map, size, nums);
+    munmap(map, size);
+}
+
+/**
+ * @brief Opens file for reading in pieces. Check is_open() afterwards.
+ */
+IntFileReader::IntFileReader(char const *file)
+{
+    fd = open(file, O_RDONLY);
+    filled = 0;
+    eof = false;
+    // No block ever needs to be bigger than a regular file itself
+    struct stat st;
+    size_hint = (size_t) -1;
+    if (fd >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+        size_hint = st.st_size + 1;
+}
+
+/**
+ * @brief Closes the file.
+ */
+IntFileReader::~IntFileReader()
+{
+    if (fd >= 0) close(fd);
+}
+
+/**
+ * @brief Parses the next whole lines of the file and appends their integers
+ * to nums.
+ *
+ * @param nums: Vector to append the integers to.
+ * @param max_bytes: Read at most this much text (unless a single line is
+ *                   longer, in which case the whole line is read).
+ * @returns false once the file is used up and nothing was read.
+ *
+ * A line cut off at the end of the block is kept and finished on the next
+ * call, so every line is parsed exactly once and in order.
+ */
+bool IntFileReader::read(std::vector<int> &nums, size_t max_bytes)
+{
+    if (fd < 0) return false;
+    if (buffer.size() < max_bytes) buffer.resize(min(max_bytes, size_hint));
+    while (true) {
+        // Top up the block, after whatever was left over from last time
+        while (!eof && filled < buffer.size()) {
+            ssize_t got = ::read(fd, &buffer[filled], buffer.size() - filled);
+            if (got <= 0) eof = true;
+            else filled += got;
+        }
+        if (filled == 0) return false;
+        if (eof) {
+            parseBuffer(&buffer[0], filled, nums);
+            filled = 0;
+            return true;
+        }
+        // Stop at the last complete line and keep the rest for next time
+        size_t end = filled;
+        while (end > 0 && buffer[end - 1] != '\n') end--;
+        if (end > 0) {
+            parseBuffer(&buffer[0], end, nums);
+            memmove(&buffer[0], &buffer[end], filled - end);
+            filled -= end;
+            return true;
+        }
+        // Not even one line fits: make room and keep reading
+        buffer.resize(buffer.size() * 2);
+    }
+}
+
+/**
+ * @brief Prints the contents of a vector to stdout, delimited by newlines.
+ *
+ * @param v: vector to be printed
+ * @param binary: write raw little-endian int32s instead of text
+ */
+void print_vector(const std::vector<int> &v, bool binary)
+{
+    IntWriter writer(stdout, binary);
+    writer.write(v.data(), v.size());
+}
+
+/**
+ * @brief "00" through "99", so two digits can be produced per division.
+ */
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/**
+ * @brief Writes value in decimal followed by a newline at out, and returns
+ * the position just past the newline. Needs at most 12 bytes.
+ */
+static inline char *formatInt(int value, char *out)
+{
+    uint32_t u = (uint32_t) value;
+    if (value < 0) {
+        *out++ = '-';
+        u = 0u - u;
+    }
+    // Fill a scratch buffer from the right, two digits at a time
+    char digits[10];
+    char *p = digits + sizeof(digits);
+    while (u >= 100) {
+        uint32_t pair = u % 100;
+        u /= 100;
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * pair, 2);
+    }
+    if (u >= 10) {
+        p -= 2;
+        memcpy(p, DIGIT_PAIRS + 2 * u, 2);
+    }
+    else {
+        *--p = (char) ('0' + u);
+    }
+    size_t len = digits + sizeof(digits) - p;
+    memcpy(out, p, len);
+    out[len] = '\n';
+    return out + len + 1;
+}
+
+/**
+ * @brief Sets up a writer to out. Nothing is written until the buffer fills
+ * or flush() is called.
+ */
+IntWriter::IntWriter(FILE *out, bool binary)
+{
+    this->out = out;
+    this->binary = binary;
+    buffer.resize(WRITE_BUFFER_BYTES);
+    used = 0;
+}
 
+/**
+ * @brief Writes out anything still buffered.
+ */
+IntWriter::~IntWriter()
+{
+    flush();
+}
+
+/**
+ * @brief Appends one integer to the output.
+ */
+void IntWriter::write(int value)
+{
+    // 12 bytes is enough for "-2147483648\n" and for a raw int
+    if (buffer.size() - used < 12) flush();
+    if (binary) {
+        uint32_t u = (uint32_t) value;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        u = __builtin_bswap32(u);
+#endif
+        memcpy(&buffer[used], &u, sizeof(u));
+        used += sizeof(u);
+    }
+    else {
+        used = formatInt(value, &buffer[used]) - &buffer[0];
+    }
+}
+
+/**
+ * @brief Appends n integers to the output.
+ */
+void IntWriter::write(const int *values, size_t n)
+{
+    if (binary) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        // Already in the output format: hand the array straight to fwrite
+        flush();
+        fwrite(values, sizeof(int), n, out);
+        fflush(out);
+#else
+        for (size_t i = 0; i < n; i++) write(values[i]);
+#endif
+        return;
+    }
+    // Text: format straight into the buffer, checking for room only once
+    // per batch of integers that is sure to fit
+    char *base = &buffer[0];
+    size_t i = 0;
+    while (i < n) {
+        size_t room = (buffer.size() - used) / 12;
+        if (room == 0) {
+            flush();
+            continue;
+        }
+        size_t batch = min(room, n - i);
+        char *p = base + used;
+        for (size_t j = 0; j < batch; j++) p = formatInt(values[i + j], p);
+        used = p - base;
+        i += batch;
+    }
+}
+
+/**
+ * @brief Hands everything buffered to the stream and flushes it.
+ */
+void IntWriter::flush()
+{
+    if (used > 0) fwrite(&buffer[0], 1, used, out);
+    used = 0;
+    fflush(out);
 }
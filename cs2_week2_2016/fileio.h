@@ -17,20 +17,120 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 using namespace std;
 
+/**
+ * @brief Smallest piece of a file, in bytes, that readFile will hand to its
+ * own parsing thread.
+ */
+#define READ_CHUNK_BYTES (1 << 20)
+
 void readFile(char const *file, std::vector<int> &nums);
+void parseBuffer(const char *data, size_t size, std::vector<int> &nums);
 
 /**
- * @brief Prints the contents of a vector to stdout, delimited by newlines.
+ * @brief Reads a file of integers, one per line, a bounded block at a time.
  *
- * @param v: vector to be printed
+ * Uses the same parser as readFile, for inputs too large to hold in memory.
  */
-inline void print_vector(std::vector<int> v)
+class IntFileReader
 {
-    for (unsigned int i = 0; i < v.size(); i++) {
-		cout << v[i] << endl;
-	}
-}
+public:
+    IntFileReader(char const *file);
+    ~IntFileReader();
+
+    /**
+     * @brief Whether the file was opened successfully.
+     */
+    bool is_open() { return fd >= 0; }
+
+    bool read(std::vector<int> &nums, size_t max_bytes);
+
+    /**
+     * @brief Whether every line of the file has been returned by read().
+     */
+    bool done() { return eof && filled == 0; }
+
+private:
+    /**
+     * @brief The file descriptor, or -1 if the file could not be opened
+     */
+    int fd;
+
+    /**
+     * @brief Holds the block being parsed
+     */
+    std::vector<char> buffer;
+
+    /**
+     * @brief Number of bytes at the front of buffer not yet parsed
+     */
+    size_t filled;
+
+    /**
+     * @brief Whether the whole file has been read into buffer
+     */
+    bool eof;
+
+    /**
+     * @brief Upper bound on the bytes left in the file, if it is known
+     */
+    size_t size_hint;
+};
+
+/**
+ * @brief Size of the buffer IntWriter formats into before each fwrite.
+ */
+#define WRITE_BUFFER_BYTES (1 << 20)
+
+void print_vector(const std::vector<int> &v, bool binary = false);
+
+/**
+ * @brief Writes integers to a stdio stream through one large buffer.
+ *
+ * In text mode every integer is written in decimal followed by a newline,
+ * byte for byte what `cout << n << endl` produces. In binary mode every
+ * integer is written as 4 raw little-endian bytes.
+ */
+class IntWriter
+{
+public:
+    IntWriter(FILE *out, bool binary);
+    ~IntWriter();
+
+    void write(int value);
+    void write(const int *values, size_t n);
+    void flush();
+
+private:
+    /**
+     * @brief The stream written to
+     */
+    FILE *out;
+
+    /**
+     * @brief Whether to write raw int32s instead of text
+     */
+    bool binary;
+
+    /**
+     * @brief Holds output not yet handed to fwrite
+     */
+    std::vector<char> buffer;
+
+    /**
+     * @brief Number of bytes of buffer in use
+     */
+    size_t used;
+};
 
 #endif
@@ -0,0 +1,175 @@
+/**
+ * @file hull_engine.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Computes the convex hull of a point file with HullEngine and
+ * reports throughput.
+ *
+ * Can also write test files of random points, so that it can be tried on
+ * millions of points without any other tools:
+ *
+ *     ./hull_engine -g 10000000 points.txt
+ *     ./hull_engine -j 4 points.txt
+ */
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <random>
+#include <cmath>
+#include "HullEngine.h"
+#include "HullAlgorithms.h"
+
+const char *engine_usage_string =
+"Usage: hull_engine [-j N] [-t TRIALS] [-p] [-c] FILE\n\
+       hull_engine -g N [--circle] [-r SEED] FILE\n\
+    Computes the convex hull of the points in FILE, one \"x y\" pair per line,\n\
+    and reports the time taken on stderr.\n\
+    -j N        threads (default: one per core)\n\
+    -t TRIALS   number of runs to take the median of (default: 5)\n\
+    -p          print the hull to stdout, one point per line\n\
+    -c          check the hull against the monotone chain in HullAlgorithms\n\
+    -g N        instead write N random points to FILE, uniform in a square,\n\
+                or with --circle all on (or next to) a circle\n\
+    -r SEED     seed for -g (default: 1)\n";
+
+/**
+ * @brief Writes n random points to the named file.
+ */
+bool writePointFile(const char *filename, size_t n, bool circle,
+    unsigned int seed)
+{
+    FILE *f = fopen(filename, "w");
+    if (f == NULL) return false;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> coord(-(1 << 20), 1 << 20);
+    std::uniform_real_distribution<double> turn(0, 2 * M_PI);
+    for (size_t i = 0; i < n; i++)
+    {
+        int x, y;
+        if (circle)
+        {
+            double a = turn(rng);
+            x = (int) lround((1 << 20) * cos(a));
+            y = (int) lround((1 << 20) * sin(a));
+        }
+        else
+        {
+            x = coord(rng);
+            y = coord(rng);
+        }
+        fprintf(f, "%d %d\n", x, y);
+    }
+    fclose(f);
+    return true;
+}
+
+/**
+ * @brief Checks that the engine's hull has the same vertices as the one
+ * monotoneChain finds, which walks the other way around.
+ */
+bool checkHull(std::vector<Tuple> &points, const std::vector<int> &hull)
+{
+    vector<Tuple*> pointers;
+    for (size_t i = 0; i < points.size(); i++) pointers.push_back(&points[i]);
+    vector<Tuple*> expected = monotoneChain(pointers);
+    if (expected.size() != hull.size()) return false;
+    std::vector<long long> a, b;
+    for (size_t i = 0; i < hull.size(); i++)
+    {
+        a.push_back((long long) points[hull[i]].x * 4294967296LL + points[hull[i]].y);
+        b.push_back((long long) expected[i]->x * 4294967296LL + expected[i]->y);
+    }
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    return a == b;
+}
+
+int main(int argc, char *argv[])
+{
+    int nthreads = 0;
+    int trials = 5;
+    bool print = false, check = false, circle = false;
+    size_t generate = 0;
+    unsigned int seed = 1;
+    const char *filename = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *arg = argv[i];
+        if (i + 1 < argc && strcmp(arg, "-j") == 0) { nthreads = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-t") == 0) { trials = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-g") == 0) { generate = atol(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-r") == 0) { seed = atoi(argv[++i]); }
+        else if (strcmp(arg, "--circle") == 0) { circle = true; }
+        else if (strcmp(arg, "-p") == 0) { print = true; }
+        else if (strcmp(arg, "-c") == 0) { check = true; }
+        else if (arg[0] != '-' && filename == NULL) { filename = arg; }
+        else
+        {
+            fprintf(stderr, "%s", engine_usage_string);
+            return 1;
+        }
+    }
+    if (filename == NULL)
+    {
+        fprintf(stderr, "%s", engine_usage_string);
+        return 1;
+    }
+    if (trials < 1) trials = 1;
+
+    if (generate > 0)
+    {
+        if (!writePointFile(filename, generate, circle, seed))
+        {
+            fprintf(stderr, "Unable to open file!\n");
+            return 1;
+        }
+        return 0;
+    }
+
+    std::vector<Tuple> points;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (!readPointFile(filename, points))
+    {
+        fprintf(stderr, "Unable to open file!\n");
+        return 1;
+    }
+    std::chrono::duration<double> read = std::chrono::steady_clock::now() - start;
+    fprintf(stderr, "read %lu points in %.3f ms (%.2f Mpoints/s)\n",
+        (unsigned long) points.size(), read.count() * 1e3,
+        points.size() / read.count() / 1e6);
+
+    HullEngine engine(nthreads);
+    std::vector<int> hull;
+    std::vector<double> seconds;
+    for (int t = 0; t < trials; t++)
+    {
+        start = std::chrono::steady_clock::now();
+        hull = engine.compute(points.empty() ? NULL : &points[0], points.size());
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        seconds.push_back(elapsed.count());
+    }
+    std::sort(seconds.begin(), seconds.end());
+    double median = seconds[trials / 2];
+    fprintf(stderr, "hull: %lu vertices, %lu points past the filter, "
+        "%.3f ms, %.2f Mpoints/s\n", (unsigned long) hull.size(),
+        (unsigned long) engine.survivors(), median * 1e3,
+        points.size() / median / 1e6);
+
+    if (print)
+    {
+        for (size_t i = 0; i < hull.size(); i++)
+            printf("%d %d\n", points[hull[i]].x, points[hull[i]].y);
+    }
+    if (check)
+    {
+        bool ok = checkHull(points, hull);
+        fprintf(stderr, "check: %s\n", ok ? "ok" : "MISMATCH");
+        if (!ok) return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file hullcli.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Runs the convex hull algorithms without SDL.
+ *
+ * Built with -DHEADLESS, so that HullAlgorithms.h swaps the SDL application
+ * for a stand-in that just collects the hull. Points come from a file of
+ * "x y" lines, or are generated at random; the chosen algorithm is run
+ * several times and its median time and throughput are printed to stderr.
+ */
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include "HullAlgorithms.h"
+
+const char *hull_usage_string =
+"Usage: hullcli [-w | -s | -m | -c] [-n N] [-t TRIALS] [-r SEED] [-p] [FILE]\n\
+    Computes the convex hull of the points in FILE, one \"x y\" pair per line,\n\
+    or of N random points if no file is given.\n\
+    -w          gift wrapping\n\
+    -s          Graham scan\n\
+    -m          monotone chain (default)\n\
+    -c          Chan's algorithm\n\
+    -n N        number of random points (default: 100000)\n\
+    -t TRIALS   number of runs to take the median of (default: 5)\n\
+    -r SEED     seed for the random points (default: 1)\n\
+    -p          print the hull to stdout, one point per line\n";
+
+/**
+ * @brief Reads "x y" pairs from the named file into points.
+ *
+ * @return `false` if the file cannot be opened.
+ */
+bool readPoints(const char *filename, vector<Tuple*> &points)
+{
+    FILE *f = fopen(filename, "r");
+    if (f == NULL) return false;
+    int x, y;
+    while (fscanf(f, "%d %d", &x, &y) == 2)
+        points.push_back(new Tuple(x, y));
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    void (*algorithm)(vector<Tuple*>, ConvexHullApp*) = DoMonotoneChain;
+    const char *name = "monotone chain";
+    size_t n = 100000;
+    int trials = 5;
+    unsigned int seed = 1;
+    bool print = false;
+    const char *filename = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *arg = argv[i];
+        if (strcmp(arg, "-w") == 0) { algorithm = DoGiftWrap; name = "gift wrap"; }
+        else if (strcmp(arg, "-s") == 0) { algorithm = DoGrahamScan; name = "Graham scan"; }
+        else if (strcmp(arg, "-m") == 0) { algorithm = DoMonotoneChain; name = "monotone chain"; }
+        else if (strcmp(arg, "-c") == 0) { algorithm = DoChan; name = "Chan"; }
+        else if (i + 1 < argc && strcmp(arg, "-n") == 0) { n = atol(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-t") == 0) { trials = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-r") == 0) { seed = atoi(argv[++i]); }
+        else if (strcmp(arg, "-p") == 0) { print = true; }
+        else if (arg[0] != '-' && filename == NULL) { filename = arg; }
+        else
+        {
+            fprintf(stderr, "%s", hull_usage_string);
+            return 1;
+        }
+    }
+    if (trials < 1) trials = 1;
+
+    vector<Tuple*> points;
+    if (filename != NULL)
+    {
+        if (!readPoints(filename, points))
+        {
+            fprintf(stderr, "Unable to open file!\n");
+            return 1;
+        }
+    }
+    else
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> coord(0, 1 << 20);
+        for (size_t i = 0; i < n; i++)
+            points.push_back(new Tuple(coord(rng), coord(rng)));
+    }
+    if (points.size() < 3)
+    {
+        fprintf(stderr, "Need at least 3 points.\n");
+        return 1;
+    }
+
+    ConvexHullApp app;
+    std::vector<double> seconds;
+    for (int t = 0; t < trials; t++)
+    {
+        app.delete_hull();
+        std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        algorithm(points, &app);
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        seconds.push_back(elapsed.count());
+    }
+    std::sort(seconds.begin(), seconds.end());
+    double median = seconds[trials / 2];
+
+    // Every algorithm closes the hull by adding its first point again
+    size_t h = app.hull.size() > 1 ? app.hull.size() - 1 : app.hull.size();
+    fprintf(stderr, "%s: %lu points, %lu on hull, %.3f ms, %.2f Mpoints/s\n",
+        name, (unsigned long) points.size(), (unsigned long) h, median * 1e3,
+        points.size() / median / 1e6);
+    if (print)
+    {
+        for (size_t i = 0; i < h; i++)
+            printf("%d %d\n", app.hull[i]->x, app.hull[i]->y);
+    }
+
+    for (unsigned int i = 0; i < points.size(); i++)
+        delete points[i];
+    return 0;
+}
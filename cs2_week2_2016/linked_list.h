@@ -0,0 +1,95 @@
+/**
+ * @file
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Example of a linked list class (header file).
+ *
+ */
+#ifndef __LINKED_LIST_H__
+#define __LINKED_LIST_H__
+
+#include <iostream>
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief Number of nodes in a list's first slab; each slab after that is
+ * twice the size of the one before, up to LIST_SLAB_MAX nodes.
+ */
+#ifndef LIST_SLAB_MIN
+#define LIST_SLAB_MIN 16
+#endif
+
+#ifndef LIST_SLAB_MAX
+#define LIST_SLAB_MAX 4096
+#endif
+
+/**
+ * A class defining the shell of a linked list data structure.
+ *
+ * The list keeps a pointer to its last node, so insert() takes O(1) time
+ * rather than walking the whole list. Its nodes are carved out of slabs
+ * (an arena), so most inserts do not allocate at all, the nodes sit next
+ * to each other in memory, and the destructor frees every slab at once
+ * without walking the list.
+ */
+class List
+{
+
+/**
+ * Public methods accessible by external code.
+ */
+public:
+    List();
+    ~List();
+    void insert(int item);
+    void printList();
+
+    /**
+     * @brief Number of items in the list.
+     */
+    int size() const { return num_elements; }
+
+/**
+ * Private data, including structure definition and class variables.
+ */
+private:
+    struct Node
+    {
+        int data;
+        Node *next;
+
+        /**
+         * Constructor for a node structure.
+         */
+        Node(int data, Node *next)
+        {
+            this->data = data;
+            this->next = next;
+        }
+    };
+    Node *head;
+    Node *tail;
+    int num_elements;
+
+    /**
+     * @brief Every slab of nodes, to be freed by the destructor.
+     */
+    std::vector<Node*> slabs;
+
+    /**
+     * @brief The unused part of the newest slab, [free_next, free_end).
+     */
+    Node *free_next;
+    Node *free_end;
+
+    Node *allocate(int item);
+
+    // The slabs belong to one list, so lists are not copied
+    List(const List &);
+    List &operator=(const List &);
+};
+
+#endif
@@ -11,16 +11,21 @@
  */
 #include "sorter.h"
 
+// The benchmark harness links in the sorts but brings its own main
+#ifndef BENCHMARK
 int main(int argc, char* argv[])
 {
     // Set up buffers and data input
     std::vector<int> nums;
     std::string line;
-    char *filename;
+    char *filename = NULL;
     int sort_type;
+    int nthreads = std::thread::hardware_concurrency();
+    int mem_limit_mb = DEFAULT_MEM_LIMIT_MB;
+    bool binary = false;
 
-    // Ensure that at most one type of sort and at least a filename are specified.
-    if (argc > 3 || argc < 2)
+    // Ensure that at least a filename is specified.
+    if (argc < 2)
     {
         usage();
     }
@@ -35,8 +40,39 @@ int main(int argc, char* argv[])
         if (strcmp(arg, "-b") == 0) { sort_type = BUBBLE_SORT; }
         else if (strcmp(arg, "-q") == 0) { sort_type = QUICK_SORT; }
         else if (strcmp(arg, "-m") == 0) { sort_type = MERGE_SORT; }
+        else if (strcmp(arg, "-m2") == 0) { sort_type = MERGE_SORT_BUFFERED; }
         else if (strcmp(arg, "-qi") == 0) { sort_type = QUICK_SORT_INPLACE; }
-        else { filename = argv[i]; }
+        else if (strcmp(arg, "-q3") == 0) { sort_type = QUICK_SORT_3WAY; }
+        else if (strcmp(arg, "-qp") == 0) { sort_type = QUICK_SORT_PARALLEL; }
+        else if (strcmp(arg, "-r") == 0) { sort_type = RADIX_SORT; }
+        else if (strcmp(arg, "-x") == 0) { sort_type = EXTERNAL_SORT; }
+        else if (strcmp(arg, "--binary") == 0) { binary = true; }
+        else if (strncmp(arg, "--mem-limit=", 12) == 0)
+        {
+            if ((mem_limit_mb = atoi(arg + 12)) < 1) { usage(); }
+        }
+        else if (strcmp(arg, "-j") == 0)
+        {
+            // The thread count is the next argument
+            if (++i == argc || (nthreads = atoi(argv[i])) < 1) { usage(); }
+        }
+        else if (filename == NULL) { filename = argv[i]; }
+        else { usage(); }
+    }
+    if (filename == NULL)
+    {
+        usage();
+    }
+    if (nthreads < 1)
+    {
+        nthreads = 1;
+    }
+
+    // The external sort streams the file itself instead of loading it
+    if (sort_type == EXTERNAL_SORT)
+    {
+        externalSort(filename, (size_t) mem_limit_mb << 20, nthreads, binary);
+        return 0;
     }
 
     // Read the file and fill our vector of integers
@@ -46,20 +82,40 @@ int main(int argc, char* argv[])
     switch (sort_type)
     {
         case BUBBLE_SORT:
-        print_vector(bubbleSort(nums));
+        print_vector(bubbleSort(nums), binary);
         break;
 
         case QUICK_SORT:
-        print_vector(quickSort(nums));
+        print_vector(quickSort(nums), binary);
         break;
 
         case MERGE_SORT:
-        print_vector(mergeSort(nums));
+        print_vector(mergeSort(nums), binary);
+        break;
+
+        case MERGE_SORT_BUFFERED:
+        mergeSortBuffered(nums);
+        print_vector(nums, binary);
         break;
 
         case QUICK_SORT_INPLACE:
         quicksort_inplace(nums, 0, nums.size() - 1);
-        print_vector(nums);
+        print_vector(nums, binary);
+        break;
+
+        case QUICK_SORT_3WAY:
+        quicksort_3way(nums, 0, nums.size() - 1);
+        print_vector(nums, binary);
+        break;
+
+        case QUICK_SORT_PARALLEL:
+        report_parallel_speedup(nums, nthreads);
+        print_vector(nums, binary);
+        break;
+
+        case RADIX_SORT:
+        radixSort(nums, nthreads);
+        print_vector(nums, binary);
         break;
 
         default:
@@ -68,6 +124,7 @@ int main(int argc, char* argv[])
     }
     return 0;
 }
+#endif
 
 /**
  * Usage    Prints out a usage statement and exits.
@@ -271,15 +328,92 @@ std::vector<int> merge(std::vector<int> &left, std::vector<int> &right)
     return merged;
 }
 
+/**
+ * Buffered Merge Sort
+ * The same recursion as mergeSort, but without a single allocation past
+ * the first one. One scratch buffer the size of the list is made up front
+ * and filled with a copy of the list. Each level of the recursion sorts
+ * its two halves into one of the two arrays and merges them into the
+ * other, so the arrays swap roles ("ping-pong") on the way down and no
+ * copy-back is ever needed. Runs of INSERTION_CUTOFF or fewer elements
+ * are finished with insertion sort, which beats merging on short runs.
+ *
+ * scratch = copy of list
+ * sortInto(scratch, list, 0, n)
+ *
+ * sortInto(src, dst, lo, hi):
+ * IF hi - lo <= cutoff
+ * 		insertion sort dst[lo, hi)
+ * 		return
+ * ENDIF
+ * sortInto(dst, src, lo, mid)
+ * sortInto(dst, src, mid, hi)
+ * merge src[lo, mid) and src[mid, hi) into dst[lo, hi)
+ */
+void mergeSortBuffered(std::vector<int> &list)
+{
+	if (list.size() <= 1) return;
+	// The only allocation: both arrays start out with the same contents
+	std::vector<int> scratch(list);
+	mergeSortInto(scratch.data(), list.data(), 0, list.size());
+}
+
+/**
+ * Sorts the elements in [lo, hi) into dst, using src (which holds the
+ * same elements in that range) as the place to sort the two halves.
+ */
+void mergeSortInto(int *src, int *dst, size_t lo, size_t hi)
+{
+	// Small runs are sorted in place in the destination
+	if (hi - lo <= INSERTION_CUTOFF) {
+		sortlib::insertion_sort(dst + lo, dst + hi);
+		return;
+	}
+	size_t mid = lo + (hi - lo) / 2;
+	// Sort each half into src so the merge can read from it
+	mergeSortInto(dst, src, lo, mid);
+	mergeSortInto(dst, src, mid, hi);
+	// If the halves are already in order, there is nothing to merge
+	if (src[mid - 1] <= src[mid]) {
+		std::copy(src + lo, src + hi, dst + lo);
+		return;
+	}
+	mergeRuns(src, lo, mid, hi, dst);
+}
+
+/**
+ * Merges the sorted runs src[lo, mid) and src[mid, hi) into dst[lo, hi).
+ * Equal elements are taken from the left run first, so the sort is stable.
+ */
+void mergeRuns(const int *src, size_t lo, size_t mid, size_t hi, int *dst)
+{
+	size_t i = lo, j = mid, k = lo;
+	// Take the smaller head until one run is used up
+	while (i < mid && j < hi) {
+		if (src[j] < src[i]) dst[k++] = src[j++];
+		else dst[k++] = src[i++];
+	}
+	// Copy whatever is left over from the other run
+	while (i < mid) dst[k++] = src[i++];
+	while (j < hi) dst[k++] = src[j++];
+}
+
 /*
  * quicksort_inplace:  In-place version of the quicksort algorithm. Requires
- *              O(1) instead of O(N) space, same time complexity. Each call of
- *              the method partitions the list around the pivot (an item taken
- *              from the middle of the array) with items left of the pivot
- *              smaller than it and items to its right larger than it. Then the
- *              method recursively sorts the left and right portions of the list
- *              until it reaches its base case: a list of length 1 is already
- *              sorted.
+ *              O(log N) instead of O(N) space, same time complexity. Each call
+ *              of the method partitions the list around the pivot (a median
+ *              of three or a ninther) with items left of
+ *              the pivot no larger than it and items to its right no smaller
+ *              than it. Then the method sorts the left and right portions of
+ *              the list until it reaches its base case.
+ *
+ *              This is an introsort (see sortlib.h): if the partitions keep
+ *              coming out lopsided (more than 2 log2(N) levels deep), the
+ *              range is finished with heapsort, so adversarial inputs such
+ *              as median-of-3 killers cannot make it quadratic. Short ranges
+ *              are finished with insertion sort, and only the smaller side
+ *              is recursed on, so the stack never grows past O(log N)
+ *              frames.
  *
  * @param list: pointer to integer array to be sorted
  * @returns:    Nothing, the array is sorted IN-PLACE.
@@ -293,53 +427,435 @@ std::vector<int> merge(std::vector<int> &left, std::vector<int> &right)
  * it. Then, we call quicksort on both parts of the list.
  * We define [left, right] as the range of values to sort in the list
  * 
- * pivot = list[midpoint(left, right)]
- * index1 = left
- * index2 = right
- * WHILE index1 <= index2
- * 		MOVE index1 until list[index1] is greater than pivot
- * 		MOVE index2 until list[index2] is less than pivot
- *		IF not crossed pivot yet
- *  		SWAP the elements at index1 and index2
+ * depth = 2 * log2(right - left + 1)
+ * WHILE more than cutoff elements in list
+ * 		IF depth used up
+ * 			heapsort(list, left, right)
+ * 			return
  * 		ENDIF
- * IF more than one element in list
- * 		return quicksort(list, left, index2)
- * 		return quicksort(list, index1, right)
- * ENDIF
+ * 		pivot = choose_pivot(list, left, right)
+ * 		PARTITION list around pivot into [left, index2] and [index1, right]
+ * 		quicksort the smaller part
+ * 		continue the loop on the larger part
+ * ENDWHILE
+ * insertion sort(list, left, right)
  */
 void quicksort_inplace(std::vector<int> &list, int left, int right)
 {
 	// If the vector has only one element (or zero)
 	if (left >= right) return;
-	// Set the pivot to the value at the middle of the vector
-	int pivot = list[(left + right)/2];
-	int i = left, j = right;
-	// Go through the vector and place elements less than the pivot
-	// value to the left of it, and elements greater than the pivot
-	// value to the right of it
-	while (i <= j) {
-		// Find an element to the left of the pivot that is greater
-		// than the pivot
-		while (pivot > list[i]) i++;
-		// Find an element to the right of the pivot that is less
-		// than the pivot
-		while (pivot < list[j]) j--;
-		// If the first element has lower index than the right element
-		// (We haven't changed indices so much we would be changing
-		// to put a larger element before or smaller element after)
-		if (i <= j) {
-			// Swap these two elements and change your indices
-			swap(list, i, j);
-			i++;
-			j--;
+	sortlib::introsort(list.begin() + left, list.begin() + right + 1);
+}
+
+/**
+ * Three-way Quicksort
+ * The same introsort as quicksort_inplace, but each partition splits the
+ * range into elements less than, equal to, and greater than the pivot.
+ * The elements equal to the pivot are never looked at again, so lists
+ * with only a handful of distinct values are sorted in close to linear
+ * time.
+ */
+void quicksort_3way(std::vector<int> &list, int left, int right)
+{
+	if (left >= right) return;
+	sortlib::introsort_3way(list.begin() + left, list.begin() + right + 1);
+}
+
+/**
+ * Parallel Quicksort
+ * The list is partitioned in place exactly as in quicksort_inplace, but
+ * each half becomes a task that any thread may pick up. Every thread owns
+ * a deque of tasks: it pushes and pops its own work at the back, and when
+ * it runs dry it steals from the front of another thread's deque, which
+ * holds the oldest and therefore largest ranges. Ranges of at most
+ * PARALLEL_CUTOFF elements are not split further and are sorted with
+ * quicksort_inplace. The sort is done when no task is left unfinished.
+ *
+ * @param list:     vector to sort IN-PLACE
+ * @param nthreads: number of threads to use, including the caller
+ */
+void quicksort_parallel(std::vector<int> &list, int nthreads)
+{
+	if (list.size() <= 1) return;
+	if (nthreads < 1) nthreads = 1;
+	std::vector<WorkStealingDeque> deques(nthreads);
+	// Counts tasks that have been pushed but not yet completely sorted
+	std::atomic<long> pending(1);
+	SortTask all = { 0, (int) list.size() - 1 };
+	deques[0].push(all);
+
+	// The calling thread does its share of the work as worker 0
+	std::vector<std::thread> workers;
+	for (int t = 1; t < nthreads; t++) {
+		workers.push_back(std::thread(quicksort_worker, std::ref(list),
+			std::ref(deques), std::ref(pending), t));
+	}
+	quicksort_worker(list, deques, pending, 0);
+	for (unsigned int t = 0; t < workers.size(); t++) workers[t].join();
+}
+
+/**
+ * The loop run by each thread of quicksort_parallel. Takes a task from
+ * its own deque (or steals one), splits it until it is small, handing
+ * the larger half of every split to its deque, and sorts what remains.
+ */
+void quicksort_worker(std::vector<int> &list,
+	std::vector<WorkStealingDeque> &deques, std::atomic<long> &pending, int id)
+{
+	int nthreads = deques.size();
+	SortTask task;
+	while (pending.load() > 0) {
+		// Prefer our own newest task, which is likely still in cache
+		bool found = deques[id].pop(task);
+		for (int k = 1; !found && k < nthreads; k++)
+			found = deques[(id + k) % nthreads].steal(task);
+		if (!found) {
+			std::this_thread::yield();
+			continue;
+		}
+		int left = task.left, right = task.right;
+		while (right - left + 1 > PARALLEL_CUTOFF) {
+			std::vector<int>::iterator first = list.begin() + left;
+			std::vector<int>::iterator last = list.begin() + right + 1;
+			std::vector<int>::iterator lo_end, hi_begin;
+			int pivot = *sortlib::choose_pivot(first, last, sortlib::Identity(),
+				sortlib::Less());
+			sortlib::partition(first, last, pivot, sortlib::Identity(),
+				sortlib::Less(), lo_end, hi_begin);
+			// The two halves are [left, j] and [i, right]
+			int j = lo_end - list.begin() - 1;
+			int i = hi_begin - list.begin();
+			// Offer the larger half to other threads, keep the smaller
+			SortTask half;
+			if (j - left > right - i) {
+				half.left = left; half.right = j;
+				left = i;
+			}
+			else {
+				half.left = i; half.right = right;
+				right = j;
+			}
+			pending++;
+			deques[id].push(half);
 		}
+		quicksort_inplace(list, left, right);
+		pending--;
 	}
-	// Quicksort the vector from the start up to where index j ended
-	// The partition might be unequal - depending on what your
-	// pivot value was
-	if (left < j) quicksort_inplace(list, left, j);
-	// Quicksort the vector from where index i started to the end
-	if (i < right) quicksort_inplace(list, i, right);
-    return;
 }
 
+/**
+ * Sorts list with quicksort_parallel and, for comparison, a copy of it
+ * with quicksort_inplace, then reports both wall times and the speedup
+ * on stderr.
+ */
+void report_parallel_speedup(std::vector<int> &list, int nthreads)
+{
+	std::vector<int> copy(list);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	quicksort_inplace(copy, 0, copy.size() - 1);
+	std::chrono::duration<double> serial = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	quicksort_parallel(list, nthreads);
+	std::chrono::duration<double> parallel = std::chrono::steady_clock::now() - start;
+
+	fprintf(stderr, "-qi: %.6f s\n-qp: %.6f s (%d threads)\nspeedup: %.2fx\n",
+		serial.count(), parallel.count(), nthreads,
+		parallel.count() > 0 ? serial.count() / parallel.count() : 0.0);
+}
+
+/**
+ * Radix Sort
+ * Least-significant-digit radix sort on the 32 bits of each integer, one
+ * 8-bit digit per pass. Each pass counts how many elements have each
+ * digit value, turns the counts into starting offsets, and moves every
+ * element to its offset in the other array. Because the moves are stable,
+ * after the last pass the list is ordered on all four digits at once.
+ * The sign bit is flipped when reading the top digit, so negative numbers
+ * come before positive ones. A pass in which every element has the same
+ * digit is skipped.
+ *
+ * With more than one thread and at least RADIX_PARALLEL_MIN elements, each
+ * pass is split across threads: every thread counts its own slice, the
+ * offsets are laid out by digit and then by thread, and every thread
+ * scatters its slice independently.
+ *
+ * @param list:     vector to sort
+ * @param nthreads: number of threads to use, including the caller
+ */
+void radixSort(std::vector<int> &list, int nthreads)
+{
+	size_t n = list.size();
+	if (n <= 1) return;
+	// The one and only scratch buffer; passes ping-pong between the two
+	std::vector<int> scratch(n);
+	int *src = list.data(), *dst = scratch.data();
+
+	if (nthreads > 1 && n >= RADIX_PARALLEL_MIN) {
+		for (int pass = 0; pass < RADIX_PASSES; pass++) {
+			if (radixPassParallel(src, dst, n, pass, nthreads))
+				std::swap(src, dst);
+		}
+	}
+	else {
+		// Build the histograms for every pass in a single read of the list
+		std::vector<size_t> counts(RADIX_PASSES * RADIX_BUCKETS, 0);
+		for (size_t i = 0; i < n; i++) {
+			for (int pass = 0; pass < RADIX_PASSES; pass++)
+				counts[pass * RADIX_BUCKETS + radixDigit(src[i], pass)]++;
+		}
+		for (int pass = 0; pass < RADIX_PASSES; pass++) {
+			size_t *count = &counts[pass * RADIX_BUCKETS];
+			// Every element has the same digit, so this pass is a no-op
+			if (count[radixDigit(src[0], pass)] == n) continue;
+			size_t offset[RADIX_BUCKETS];
+			size_t total = 0;
+			for (int d = 0; d < RADIX_BUCKETS; d++) {
+				offset[d] = total;
+				total += count[d];
+			}
+			for (size_t i = 0; i < n; i++)
+				dst[offset[radixDigit(src[i], pass)]++] = src[i];
+			std::swap(src, dst);
+		}
+	}
+
+	// An odd number of passes leaves the result in the scratch buffer
+	if (src != list.data()) std::copy(src, src + n, list.data());
+}
+
+/**
+ * Returns digit number pass (0 is least significant) of value, with the
+ * sign bit flipped so that the digits order negative values first.
+ */
+unsigned int radixDigit(int value, int pass)
+{
+	unsigned int key = (unsigned int) value ^ 0x80000000u;
+	return (key >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1);
+}
+
+/**
+ * Runs one pass of radixSort from src into dst on nthreads threads.
+ * Returns false, without touching dst, when every element has the same
+ * digit and the pass can be skipped.
+ */
+bool radixPassParallel(const int *src, int *dst, size_t n, int pass,
+	int nthreads)
+{
+	std::vector<size_t> counts(nthreads * RADIX_BUCKETS, 0);
+	std::vector<std::thread> workers;
+
+	// Each thread counts the digits in its own slice of src
+	for (int t = 0; t < nthreads; t++) {
+		workers.push_back(std::thread([=, &counts]() {
+			size_t *count = &counts[t * RADIX_BUCKETS];
+			for (size_t i = n * t / nthreads; i < n * (t + 1) / nthreads; i++)
+				count[radixDigit(src[i], pass)]++;
+		}));
+	}
+	for (int t = 0; t < nthreads; t++) workers[t].join();
+	workers.clear();
+
+	// Offsets go by digit first and thread second, which keeps the
+	// scatter stable
+	size_t total = 0;
+	for (int d = 0; d < RADIX_BUCKETS; d++) {
+		size_t bucket = 0;
+		for (int t = 0; t < nthreads; t++) {
+			size_t count = counts[t * RADIX_BUCKETS + d];
+			counts[t * RADIX_BUCKETS + d] = total;
+			total += count;
+			bucket += count;
+		}
+		if (bucket == n) return false;
+	}
+
+	// Each thread moves its slice to the offsets it was handed
+	for (int t = 0; t < nthreads; t++) {
+		workers.push_back(std::thread([=, &counts]() {
+			size_t *offset = &counts[t * RADIX_BUCKETS];
+			for (size_t i = n * t / nthreads; i < n * (t + 1) / nthreads; i++)
+				dst[offset[radixDigit(src[i], pass)]++] = src[i];
+		}));
+	}
+	for (int t = 0; t < nthreads; t++) workers[t].join();
+	return true;
+}
+
+/**
+ * External Sort
+ * Sorts a file that may be much larger than memory, using at most about
+ * mem_limit bytes. The file is read in blocks of text small enough that
+ * the parsed integers and radixSort's scratch buffer fit in the limit.
+ * Each block is radix sorted and spilled to a temporary file as raw ints
+ * (a "run"). Then all runs are merged at once: each run is read back
+ * through its own large buffer, and a loser tree picks the smallest head
+ * among them with about log2(runs) comparisons per element. Timings for
+ * both phases are printed on stderr.
+ *
+ * @param file:      file of integers, one per line
+ * @param mem_limit: memory budget in bytes
+ * @param nthreads:  number of threads for sorting each run
+ * @param binary:    write the result as raw int32s instead of text
+ */
+void externalSort(char const *file, size_t mem_limit, int nthreads,
+	bool binary)
+{
+	IntFileReader reader(file);
+	if (!reader.is_open()) {
+		std::cout << "Unable to open file!";
+		return;
+	}
+	// Every line ends in '\n', and even an empty one parses to an int, so
+	// a block parses to at most one int per byte, 4 * block bytes of ints;
+	// radixSort needs as much again for scratch, and the text itself is
+	// one more block
+	size_t block_bytes = std::max(mem_limit / 9, (size_t) MIN_BLOCK_BYTES);
+
+	// Phase 1: cut the input into sorted runs on disk
+	std::vector<FILE*> runs;
+	std::vector<int> nums;
+	double read_time = 0, sort_time = 0, spill_time = 0;
+	while (true) {
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		nums.clear();
+		bool more = reader.read(nums, block_bytes);
+		std::chrono::steady_clock::time_point read = std::chrono::steady_clock::now();
+		read_time += std::chrono::duration<double>(read - start).count();
+		if (!more) break;
+
+		radixSort(nums, nthreads);
+		std::chrono::steady_clock::time_point sorted = std::chrono::steady_clock::now();
+		sort_time += std::chrono::duration<double>(sorted - read).count();
+
+		// The whole input fit in one run, so it never has to hit the disk
+		if (runs.empty() && reader.done()) {
+			fprintf(stderr, "runs: read %.3f s, sort %.3f s (1 run, in memory)\n",
+				read_time, sort_time);
+			print_vector(nums, binary);
+			return;
+		}
+
+		FILE *run = tmpfile();
+		if (run == NULL || fwrite(nums.data(), sizeof(int), nums.size(), run)
+			!= nums.size()) {
+			perror("sorter: spilling run");
+			exit(1);
+		}
+		runs.push_back(run);
+		spill_time += std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - sorted).count();
+	}
+	// Give the memory back before the merge claims it for buffers
+	std::vector<int>().swap(nums);
+	fprintf(stderr, "runs: read %.3f s, sort %.3f s, spill %.3f s (%u runs)\n",
+		read_time, sort_time, spill_time, (unsigned int) runs.size());
+	if (runs.empty()) return;
+
+	// Phase 2: merge every run at once, splitting half the memory budget
+	// between the runs' read buffers
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	size_t buffer_ints = std::max(mem_limit / 2 / sizeof(int) / runs.size(),
+		(size_t) MIN_RUN_BUFFER_INTS);
+	std::vector<RunReader> readers;
+	for (unsigned int i = 0; i < runs.size(); i++) {
+		rewind(runs[i]);
+		readers.push_back(RunReader(runs[i], buffer_ints));
+	}
+	LoserTree tree(readers);
+	IntWriter writer(stdout, binary);
+	int value;
+	while (tree.pop(value)) writer.write(value);
+	writer.flush();
+	for (unsigned int i = 0; i < runs.size(); i++) fclose(runs[i]);
+	fprintf(stderr, "merge: %.3f s\n", std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - start).count());
+}
+
+/**
+ * Sets up a reader for one spilled run, reading buffer_ints at a time.
+ */
+RunReader::RunReader(FILE *file, size_t buffer_ints)
+{
+	this->file = file;
+	buffer.resize(buffer_ints);
+	pos = 0;
+	len = 0;
+}
+
+/**
+ * Stores the run's next integer in value, refilling the buffer with one
+ * large read when it runs out. Returns false at the end of the run.
+ */
+bool RunReader::next(int &value)
+{
+	if (pos == len) {
+		len = fread(buffer.data(), sizeof(int), buffer.size(), file);
+		pos = 0;
+		if (len == 0) return false;
+	}
+	value = buffer[pos++];
+	return true;
+}
+
+/**
+ * Builds the tree over the first element of every run.
+ *
+ * Runs are the leaves, stored at tree positions k through 2k - 1; the
+ * internal nodes 1 through k - 1 each remember the run that lost the
+ * comparison there, and tree[0] holds the overall winner.
+ */
+LoserTree::LoserTree(std::vector<RunReader> &runs) : runs(runs)
+{
+	k = runs.size();
+	heads.resize(k);
+	live.resize(k);
+	for (int i = 0; i < k; i++) live[i] = runs[i].next(heads[i]);
+	tree.resize(k);
+	tree[0] = build(1);
+}
+
+/**
+ * Plays the matches in the subtree under node and returns its winner.
+ */
+int LoserTree::build(int node)
+{
+	if (node >= k) return node - k;
+	int left = build(2 * node), right = build(2 * node + 1);
+	if (beats(right, left)) {
+		tree[node] = left;
+		return right;
+	}
+	tree[node] = right;
+	return left;
+}
+
+/**
+ * Whether run a's head comes before run b's. Finished runs lose to
+ * everything; ties go to the lower run number.
+ */
+bool LoserTree::beats(int a, int b)
+{
+	if (!live[a]) return false;
+	if (!live[b]) return true;
+	return heads[a] < heads[b] || (heads[a] == heads[b] && a < b);
+}
+
+/**
+ * Removes the smallest remaining element and stores it in value, then
+ * replays the winner's path to the root with its run's next element.
+ * Returns false once every run is finished.
+ */
+bool LoserTree::pop(int &value)
+{
+	int winner = tree[0];
+	if (!live[winner]) return false;
+	value = heads[winner];
+	live[winner] = runs[winner].next(heads[winner]);
+	for (int node = (winner + k) / 2; node > 0; node /= 2) {
+		if (beats(tree[node], winner)) std::swap(tree[node], winner);
+	}
+	tree[0] = winner;
+	return true;
+}
@@ -16,7 +16,15 @@
 #include <string>
 #include <string.h>
 #include <cstdlib>
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include "fileio.h"
+#include "sortlib.h"
 
 #ifndef BUBBLE_SORT
 #define BUBBLE_SORT 0
@@ -34,21 +42,195 @@
 #define QUICK_SORT_INPLACE 3
 #endif
 
+#ifndef MERGE_SORT_BUFFERED
+#define MERGE_SORT_BUFFERED 4
+#endif
+
+#ifndef QUICK_SORT_PARALLEL
+#define QUICK_SORT_PARALLEL 5
+#endif
+
+#ifndef RADIX_SORT
+#define RADIX_SORT 6
+#endif
+
+#ifndef QUICK_SORT_3WAY
+#define QUICK_SORT_3WAY 7
+#endif
+
+#ifndef EXTERNAL_SORT
+#define EXTERNAL_SORT 8
+#endif
+
+/**
+ * Runs at most this long are finished with insertion sort.
+ */
+#ifndef INSERTION_CUTOFF
+#define INSERTION_CUTOFF 24
+#endif
+
+/**
+ * Ranges at most this long are not split into parallel tasks.
+ */
+#ifndef PARALLEL_CUTOFF
+#define PARALLEL_CUTOFF 4096
+#endif
+
+/**
+ * Radix sort digit size and the resulting number of buckets and passes.
+ */
+#define RADIX_BITS 8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define RADIX_PASSES (32 / RADIX_BITS)
+
+/**
+ * Lists shorter than this are radix sorted on one thread.
+ */
+#ifndef RADIX_PARALLEL_MIN
+#define RADIX_PARALLEL_MIN (1 << 16)
+#endif
+
+/**
+ * Memory budget of the external sort, in megabytes, unless --mem-limit is
+ * given, and the smallest text block and merge buffer it will use no matter
+ * how small the budget.
+ */
+#ifndef DEFAULT_MEM_LIMIT_MB
+#define DEFAULT_MEM_LIMIT_MB 1024
+#endif
+#define MIN_BLOCK_BYTES (1 << 16)
+#define MIN_RUN_BUFFER_INTS (1 << 14)
+
+/**
+ * A range [left, right] of the list still waiting to be sorted.
+ */
+struct SortTask
+{
+    int left;
+    int right;
+};
+
+/**
+ * @brief A deque of sort tasks owned by one thread of quicksort_parallel.
+ *
+ * The owner pushes and pops at the back; other threads steal from the
+ * front. A plain mutex is enough here because every task is thousands of
+ * elements of work, so the deque is touched rarely.
+ */
+class WorkStealingDeque
+{
+public:
+    void push(SortTask task)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        tasks.push_back(task);
+    }
+
+    bool pop(SortTask &task)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (tasks.empty()) return false;
+        task = tasks.back();
+        tasks.pop_back();
+        return true;
+    }
+
+    bool steal(SortTask &task)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (tasks.empty()) return false;
+        task = tasks.front();
+        tasks.pop_front();
+        return true;
+    }
+
+private:
+    std::deque<SortTask> tasks;
+    std::mutex lock;
+};
+
 std::vector<int> bubbleSort(std::vector<int> &list);
 void swap(std::vector<int> &list, int i, int j);
 std::vector<int> quickSort(std::vector<int> &list);
 std::vector<int> concat(std::vector<int> &less, int pivot, std::vector<int> &greater);
 void quicksort_inplace(std::vector<int> &list, int left, int right);
+void quicksort_3way(std::vector<int> &list, int left, int right);
 std::vector<int> mergeSort(std::vector<int> &list);
 std::vector<int> merge(std::vector<int> &left, std::vector<int> &right);
+void mergeSortBuffered(std::vector<int> &list);
+void mergeSortInto(int *src, int *dst, size_t lo, size_t hi);
+void mergeRuns(const int *src, size_t lo, size_t mid, size_t hi, int *dst);
+void quicksort_parallel(std::vector<int> &list, int nthreads);
+void quicksort_worker(std::vector<int> &list,
+    std::vector<WorkStealingDeque> &deques, std::atomic<long> &pending, int id);
+void report_parallel_speedup(std::vector<int> &list, int nthreads);
+void radixSort(std::vector<int> &list, int nthreads);
+unsigned int radixDigit(int value, int pass);
+bool radixPassParallel(const int *src, int *dst, size_t n, int pass,
+    int nthreads);
+void externalSort(char const *file, size_t mem_limit, int nthreads,
+    bool binary);
 void usage();
 
-const char *usage_string =
-"Usage: sorter [-b] [-m] [-q] [-qi] FILE\n\
+/**
+ * @brief Streams one sorted run back from its temporary file.
+ */
+class RunReader
+{
+public:
+    RunReader(FILE *file, size_t buffer_ints);
+    bool next(int &value);
+
+private:
+    FILE *file;
+    std::vector<int> buffer;
+    size_t pos;
+    size_t len;
+};
+
+/**
+ * @brief A tournament tree of losers for merging k sorted runs.
+ *
+ * Each pop costs one comparison per level, against the stored loser,
+ * rather than the two per level a binary heap needs.
+ */
+class LoserTree
+{
+public:
+    LoserTree(std::vector<RunReader> &runs);
+    bool pop(int &value);
+
+private:
+    int build(int node);
+    bool beats(int a, int b);
+
+    std::vector<RunReader> &runs;
+    std::vector<int> heads;
+    std::vector<bool> live;
+    std::vector<int> tree;
+    int k;
+};
+
+const char usage_string[] =
+"Usage: sorter [-b] [-m] [-m2] [-q] [-qi] [-q3] [-qp] [-r]\n\
+              [-x [--mem-limit=MB]] [-j N] [--binary] FILE\n\
     Sorts a file that contains integers delimited by newlines and prints the \
 result to stdout.\n\
     -b      bubble sort\n\
     -m      merge sort\n\
+    -m2     merge sort with a single scratch buffer\n\
     -q      quick sort\n\
-    -qi     in-place quick sort\n\
+    -qi     in-place quick sort (introsort)\n\
+    -q3     in-place quick sort with three-way partitioning, for inputs\n\
+            with many duplicates\n\
+    -qp     parallel in-place quick sort; reports time and speedup over -qi\n\
+            on stderr\n\
+    -r      LSD radix sort\n\
+    -x      external sort, for files larger than memory; reports per-phase\n\
+            timings on stderr\n\
+    --mem-limit=MB\n\
+            memory budget for -x (default: 1024)\n\
+    -j N    number of threads for -qp, -r and -x (default: one per core)\n\
+    --binary\n\
+            write the result as raw little-endian int32s instead of text\n\
     No option defaults to bubble sort.\n";
@@ -0,0 +1,306 @@
+/**
+ * @file sortlib.h
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief A header-only introsort for any random-access range (header file).
+ *
+ * Every function takes a key projection and a comparator. Elements are
+ * ordered by comp(key(a), key(b)), so an array of structs can be sorted by
+ * one of its fields without first splitting it into parallel arrays:
+ *
+ *     sortlib::introsort(pts.begin(), pts.end(),
+ *         [](const KeyedPoint &p) { return p.angle; });
+ *
+ * Both default to the element itself and operator<. Since they are template
+ * parameters, the compiler inlines them, so a plain vector<int> sorts just as
+ * fast as with a hand-written quicksort.
+ */
+
+#ifndef __SORTLIB_H__
+#define __SORTLIB_H__
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+
+namespace sortlib
+{
+
+/**
+ * @brief Ranges at most this long are finished with insertion sort.
+ */
+const std::ptrdiff_t SORTLIB_INSERTION_CUTOFF = 24;
+
+/**
+ * @brief Ranges longer than this use a ninther rather than a median of three.
+ */
+const std::ptrdiff_t NINTHER_THRESHOLD = 128;
+
+/**
+ * @brief Key projection that returns the element itself.
+ */
+struct Identity
+{
+    template <typename T>
+    const T &operator()(const T &x) const { return x; }
+};
+
+/**
+ * @brief Comparator that uses operator<.
+ */
+struct Less
+{
+    template <typename T>
+    bool operator()(const T &a, const T &b) const { return a < b; }
+};
+
+/**
+ * @brief Insertion sort of [first, last). Each element is shifted left until
+ * the element before it is no larger; very fast on short or nearly sorted
+ * ranges.
+ */
+template <typename It, typename Key, typename Compare>
+void insertion_sort(It first, It last, Key key, Compare comp)
+{
+    typedef typename std::iterator_traits<It>::value_type T;
+    if (last - first < 2) return;
+    for (It i = first + 1; i < last; ++i) {
+        T item = std::move(*i);
+        It j = i;
+        while (j > first && comp(key(item), key(*(j - 1)))) {
+            *j = std::move(*(j - 1));
+            --j;
+        }
+        *j = std::move(item);
+    }
+}
+
+template <typename It>
+void insertion_sort(It first, It last)
+{
+    insertion_sort(first, last, Identity(), Less());
+}
+
+/**
+ * @brief Moves heap[root] down the n-element max-heap until both of its
+ * children are no larger than it.
+ */
+template <typename It, typename Key, typename Compare>
+void sift_down(It heap, std::ptrdiff_t root, std::ptrdiff_t n, Key key,
+    Compare comp)
+{
+    typedef typename std::iterator_traits<It>::value_type T;
+    T item = std::move(heap[root]);
+    while (true) {
+        std::ptrdiff_t child = 2 * root + 1;
+        if (child >= n) break;
+        if (child + 1 < n && comp(key(heap[child]), key(heap[child + 1])))
+            child++;
+        if (!comp(key(item), key(heap[child]))) break;
+        heap[root] = std::move(heap[child]);
+        root = child;
+    }
+    heap[root] = std::move(item);
+}
+
+/**
+ * @brief Heapsort of [first, last). Builds a max-heap in place, then
+ * repeatedly moves the largest remaining element to the end. O(N log N) no
+ * matter what the input looks like.
+ */
+template <typename It, typename Key, typename Compare>
+void heapsort(It first, It last, Key key, Compare comp)
+{
+    std::ptrdiff_t n = last - first;
+    for (std::ptrdiff_t i = n / 2 - 1; i >= 0; i--)
+        sift_down(first, i, n, key, comp);
+    for (std::ptrdiff_t end = n - 1; end > 0; end--) {
+        std::iter_swap(first, first + end);
+        sift_down(first, 0, end, key, comp);
+    }
+}
+
+/**
+ * @brief Returns whichever of a, b and c holds the median key.
+ */
+template <typename It, typename Key, typename Compare>
+It median3(It a, It b, It c, Key key, Compare comp)
+{
+    if (comp(key(*a), key(*b))) {
+        if (comp(key(*b), key(*c))) return b;
+        return comp(key(*a), key(*c)) ? c : a;
+    }
+    if (comp(key(*a), key(*c))) return a;
+    return comp(key(*b), key(*c)) ? c : b;
+}
+
+/**
+ * @brief Picks a pivot for the non-empty range [first, last): the median of
+ * the first, middle, and last elements, or for long ranges the median of
+ * three such medians spread across the range (Tukey's ninther).
+ */
+template <typename It, typename Key, typename Compare>
+It choose_pivot(It first, It last, Key key, Compare comp)
+{
+    std::ptrdiff_t n = last - first;
+    It mid = first + n / 2, back = last - 1;
+    if (n > NINTHER_THRESHOLD) {
+        std::ptrdiff_t s = n / 8;
+        return median3(
+            median3(first, first + s, first + 2 * s, key, comp),
+            median3(mid - s, mid, mid + s, key, comp),
+            median3(back - 2 * s, back - s, back, key, comp), key, comp);
+    }
+    return median3(first, mid, back, key, comp);
+}
+
+/**
+ * @brief Hoare partition of [first, last) around the key pivot, which must
+ * be the key of some element in the range.
+ *
+ * Afterwards every element of [first, lo_end) is no greater than pivot and
+ * every element of [hi_begin, last) is no less than pivot, with
+ * lo_end <= hi_begin.
+ */
+template <typename It, typename K, typename Key, typename Compare>
+void partition(It first, It last, const K &pivot, Key key, Compare comp,
+    It &lo_end, It &hi_begin)
+{
+    std::ptrdiff_t i = 0, j = (last - first) - 1;
+    while (i <= j) {
+        while (comp(key(first[i]), pivot)) i++;
+        while (comp(pivot, key(first[j]))) j--;
+        if (i <= j) {
+            std::iter_swap(first + i, first + j);
+            i++;
+            j--;
+        }
+    }
+    lo_end = first + (j + 1);
+    hi_begin = first + i;
+}
+
+/**
+ * @brief Three-way (Dutch national flag) partition of [first, last) around
+ * the key pivot.
+ *
+ * Afterwards every element of [first, lo_end) is less than pivot, every
+ * element of [lo_end, hi_begin) is equivalent to it, and every element of
+ * [hi_begin, last) is greater than it.
+ */
+template <typename It, typename K, typename Key, typename Compare>
+void partition_3way(It first, It last, const K &pivot, Key key, Compare comp,
+    It &lo_end, It &hi_begin)
+{
+    It lt = first, gt = last, k = first;
+    while (k < gt) {
+        if (comp(key(*k), pivot)) std::iter_swap(lt++, k++);
+        else if (comp(pivot, key(*k))) std::iter_swap(k, --gt);
+        else ++k;
+    }
+    lo_end = lt;
+    hi_begin = gt;
+}
+
+/**
+ * @brief The loop behind introsort and introsort_3way. Sorts [first, last),
+ * falling back to heapsort once depth more levels of partitioning have been
+ * used. Only the smaller side is recursed on, so the stack stays O(log N).
+ */
+template <typename It, typename Key, typename Compare>
+void introsort_loop(It first, It last, int depth, Key key, Compare comp,
+    bool three_way)
+{
+    typedef typename std::decay<decltype(key(*first))>::type K;
+    while (last - first > SORTLIB_INSERTION_CUTOFF) {
+        // Too many bad pivots: heapsort is O(N log N) no matter what
+        if (depth-- == 0) {
+            heapsort(first, last, key, comp);
+            return;
+        }
+        // Copy the pivot's key, since partitioning moves the element
+        K pivot = key(*choose_pivot(first, last, key, comp));
+        It lo_end, hi_begin;
+        if (three_way) partition_3way(first, last, pivot, key, comp, lo_end, hi_begin);
+        else partition(first, last, pivot, key, comp, lo_end, hi_begin);
+        if (lo_end - first < last - hi_begin) {
+            introsort_loop(first, lo_end, depth, key, comp, three_way);
+            first = hi_begin;
+        }
+        else {
+            introsort_loop(hi_begin, last, depth, key, comp, three_way);
+            last = lo_end;
+        }
+    }
+    insertion_sort(first, last, key, comp);
+}
+
+/**
+ * @brief Returns 2 floor(log2(n)), the partitioning depth introsort allows
+ * before it switches to heapsort.
+ */
+inline int depth_limit(std::ptrdiff_t n)
+{
+    int depth = 0;
+    while (n > 1) {
+        n >>= 1;
+        depth += 2;
+    }
+    return depth;
+}
+
+/**
+ * @brief Sorts [first, last) by comp(key(a), key(b)).
+ *
+ * Quicksort with median-of-three or ninther pivots, falling back to heapsort
+ * when partitions keep coming out lopsided and to insertion sort on short
+ * ranges. O(N log N) worst case, O(log N) stack, not stable.
+ */
+template <typename It, typename Key, typename Compare>
+void introsort(It first, It last, Key key, Compare comp)
+{
+    introsort_loop(first, last, depth_limit(last - first), key, comp, false);
+}
+
+template <typename It, typename Key>
+void introsort(It first, It last, Key key)
+{
+    introsort(first, last, key, Less());
+}
+
+template <typename It>
+void introsort(It first, It last)
+{
+    introsort(first, last, Identity(), Less());
+}
+
+/**
+ * @brief Like introsort, but partitions three ways, so elements equal to the
+ * pivot are never looked at again. Much faster when there are only a handful
+ * of distinct keys.
+ */
+template <typename It, typename Key, typename Compare>
+void introsort_3way(It first, It last, Key key, Compare comp)
+{
+    introsort_loop(first, last, depth_limit(last - first), key, comp, true);
+}
+
+template <typename It, typename Key>
+void introsort_3way(It first, It last, Key key)
+{
+    introsort_3way(first, last, key, Less());
+}
+
+template <typename It>
+void introsort_3way(It first, It last)
+{
+    introsort_3way(first, last, Identity(), Less());
+}
+
+}
+
+#endif
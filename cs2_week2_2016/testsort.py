@@ -7,11 +7,16 @@ def main():
     check_quickSort()
     check_mergeSort()
     check_inplace_qs()
+    check_sort("-m2", "buffered merge sort")
+    check_sort("-q3", "three-way quicksort")
+    check_sort("-qp", "parallel quicksort")
+    check_sort("-x", "external sort")
+    check_sort("-r", "radix sort")
     print
 
 def listify_output(s):
     ''' Turns raw output from sorter program into list of ints. '''
-    return map(int, filter(isInt, s.split()))
+    return list(map(int, filter(isInt, s.split())))
 
 def check_mergeSort():
     print("Checking merge sort...")
@@ -89,6 +94,26 @@ def check_inplace_qs():
     print
     return
 
+def check_sort(flag, name):
+    ''' Checks the sorter mode selected by flag on NUM_TESTS random lists. '''
+    print("Checking %s..." % name)
+    for i in range(NUM_TESTS):
+        nums = generate_nums(i);
+        try:
+            raw_out = check_output(["./sorter", flag, "out"])
+        except:
+            print("Student program crashed...")
+            return
+        lst_out = listify_output(raw_out)
+        if (sorted(nums) == lst_out):
+            sys.stdout.write(".")
+        else:
+            print("Student %s failed on test case:" % name)
+            print(nums)
+            print("Student output: "), lst_out
+    print
+    return
+
 def generate_nums(n):
     lst = [random.randint(MIN_VAL, MAX_VAL) for i in range(n)]
     f = open("out", 'w')
@@ -0,0 +1,152 @@
+/**
+ * @file AStarSolver.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Functions for A* maze solver class.
+ */
+
+#include "AStarSolver.hpp"
+
+#ifdef MAZE_ANIMATE
+#include "MazeSolverApp.hpp"
+#endif
+
+#define ANIMATION_DELAY     (25)
+
+/**
+ * @brief Directions in the order of the index stored in from_low and
+ * from_high, and the steps they take.
+ */
+static const int directions[] = {N, S, E, W};
+static const int dx[] = {0, 0, 1, -1};
+static const int dy[] = {-1, 1, 0, 0};
+
+/**
+ * @brief Initializes the solver.
+ *
+ * @param[in] app Pointer to the main MazeSolverApp class.
+ */
+AStarSolver::AStarSolver(class MazeSolverApp *app)
+    : current_bucket(0), current(-1, -1)
+{
+    this->app = app;
+}
+
+/**
+ * @brief Deinitializes the solver.
+ */
+AStarSolver::~AStarSolver()
+{
+}
+
+/**
+ * @brief Redraws the maze and the path to the current cell, so that the
+ * search can be watched; does nothing without MAZE_ANIMATE.
+ */
+void AStarSolver::render()
+{
+#ifdef MAZE_ANIMATE
+    SDL_Delay(ANIMATION_DELAY);
+    this->app->OnRender();
+#endif
+}
+
+/**
+ * @brief Adds (x, y), reached from the cell in direction
+ * directions[back], to the open set: to the bucket after the current
+ * one if it is further from the end than the cell it was reached from.
+ */
+void AStarSolver::reach(int x, int y, int back, bool further)
+{
+    buckets[current_bucket ^ further].push_back(OpenCell(x, y, back));
+}
+
+/**
+ * @brief Solve the maze given by `maze`.
+ *
+ * @param[in] maze MazeGrid object that stores the maze to be
+ * solved.
+ */
+void AStarSolver::solve(MazeGrid *maze)
+{
+    int width = maze->get_width(), height = maze->get_height();
+    visited.resize(width, height);
+    from_low.resize(width, height);
+    from_high.resize(width, height);
+    buckets[0].clear();
+    buckets[1].clear();
+    current_bucket = 0;
+    expanded = 0;
+
+    reach(MAZE_START_X, MAZE_START_Y, 0, false);
+    while (true)
+    {
+        /* Once the smallest f is used up, the next bucket holds the new
+           smallest, and the one after it is the empty one. */
+        if (buckets[current_bucket].empty())
+        {
+            current_bucket ^= 1;
+            if (buckets[current_bucket].empty())
+                break;
+        }
+        OpenCell next = buckets[current_bucket].back();
+        buckets[current_bucket].pop_back();
+
+        /* Skip copies of cells already expanded. */
+        current = next.c;
+        if (visited.get(current.x, current.y))
+            continue;
+        visited.set(current.x, current.y);
+        if (next.back & 1)
+            from_low.set(current.x, current.y);
+        if (next.back & 2)
+            from_high.set(current.x, current.y);
+        render();
+
+        if (current.x == width - 1 && current.y == height - 1)
+        {
+#ifndef HEADLESS
+            printf("COMPLETED THE MAZE!!!\n");
+#endif
+            return;
+        }
+
+        /* The end is to the south-east, so steps north and west take
+           the cell further from it. */
+        int dir = maze->get_possible_moves(current.x, current.y);
+        expanded++;
+        for (int i = 0; i < 4; i++)
+        {
+            int nx = current.x + dx[i], ny = current.y + dy[i];
+            if ((dir & directions[i]) && !visited.get(nx, ny))
+                reach(nx, ny, i ^ 1, directions[i] == N || directions[i] == W);
+        }
+    }
+    current = Coordinate(-1, -1);
+}
+
+/**
+ * @brief Retrieves the current path through the maze.
+ *
+ * @return Vector storing the current path through the maze, from the
+ * cell being expanded (the end, once solved) back to the start.
+ */
+vector<Coordinate> AStarSolver::get_path()
+{
+    vector<Coordinate> list;
+    Coordinate c = current;
+
+    if (c.x == -1 && c.y == -1)
+        return list;
+
+    list.push_back(c);
+    while (c.x != MAZE_START_X || c.y != MAZE_START_Y)
+    {
+        int back = from_low.get(c.x, c.y) | (from_high.get(c.x, c.y) << 1);
+        c = Coordinate(c.x + dx[back], c.y + dy[back]);
+        list.push_back(c);
+    }
+    return list;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file AStarSolver.hpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Definitions for A* maze solver class.
+ */
+
+#ifndef __ASTARSOLVER_H__
+#define __ASTARSOLVER_H__
+
+#include <cstdio>
+#include <vector>
+#include "MazeSolverBase.hpp"
+
+/**
+ * @brief Encapsulates an A* maze solver.
+ *
+ * A* always expands the cell with the smallest estimate of the length of
+ * a path through it, f = g + h: the steps taken to reach it (g), plus the
+ * Manhattan distance from it to the end (h), which can only be too
+ * short. Taking a step towards the end leaves f the same and taking one
+ * away from it adds 2, so every cell waiting to be expanded has f equal
+ * to the smallest f or to that plus 2, and the open set is a bucket
+ * queue with just those two buckets. Within a bucket the newest cell
+ * comes out first, so the search keeps going the way it was going.
+ *
+ * A cell can be reached more than once, in a maze with loops, so it can
+ * be in the open set more than once, each time with the direction it was
+ * reached from. Since h never drops by more than a step, the first time
+ * a cell comes out of the open set it was reached by a shortest path;
+ * only then is it marked visited and its direction kept, in two bitmaps
+ * like the breadth-first solver's, and later copies are skipped.
+ */
+class AStarSolver : public MazeSolverBase
+{
+public:
+    AStarSolver(class MazeSolverApp *app);
+    ~AStarSolver();
+
+    void solve(MazeGrid *maze);
+    vector<Coordinate> get_path();
+
+private:
+    class MazeSolverApp *app;
+    /**
+     * @brief A cell in the open set, and the index into {N, S, E, W} of
+     * the direction back to the cell it was reached from.
+     */
+    struct OpenCell
+    {
+        Coordinate c;
+        int back;
+
+        OpenCell(int x, int y, int back) : c(x, y), back(back) { }
+    };
+
+    /* The cells with the smallest f, and those with f 2 more. */
+    vector<OpenCell> buckets[2];
+    int current_bucket;
+    /* The cell being expanded, which get_path() traces back from. */
+    Coordinate current;
+    CellBitmap visited;
+    /* The direction back to the cell each cell was reached from, as an
+       index into {N, S, E, W}: bit 0 in from_low, bit 1 in from_high. */
+    CellBitmap from_low, from_high;
+
+    void reach(int x, int y, int back, bool further);
+    void render();
+};
+
+#endif
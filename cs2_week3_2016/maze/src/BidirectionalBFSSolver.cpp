@@ -0,0 +1,174 @@
+/**
+ * @file BidirectionalBFSSolver.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Functions for bidirectional breadth-first maze solver class.
+ */
+
+#include <algorithm>
+#include "BidirectionalBFSSolver.hpp"
+
+/**
+ * @brief Directions in the order of the index stored in from_low and
+ * from_high, and the steps they take.
+ */
+static const int directions[] = {N, S, E, W};
+static const int dx[] = {0, 0, 1, -1};
+static const int dy[] = {-1, 1, 0, 0};
+
+/**
+ * @brief Initializes the solver.
+ *
+ * @param[in] app Pointer to the main MazeSolverApp class.
+ */
+BidirectionalBFSSolver::BidirectionalBFSSolver(class MazeSolverApp *app)
+    : current(-1, -1), current_side(0), met(false)
+{
+    queues[0] = new CoordinateQueue(app);
+    queues[1] = new CoordinateQueue(app);
+}
+
+/**
+ * @brief Deinitializes the solver.
+ */
+BidirectionalBFSSolver::~BidirectionalBFSSolver()
+{
+    delete queues[0];
+    delete queues[1];
+}
+
+/**
+ * @brief Marks (x, y) visited by side, remembers that the cell it was
+ * reached from is in direction directions[back], and enqueues it on
+ * side's queue.
+ */
+void BidirectionalBFSSolver::visit(int side, int x, int y, int back)
+{
+    visited[side].set(x, y);
+    if (back & 1)
+        from_low[side].set(x, y);
+    if (back & 2)
+        from_high[side].set(x, y);
+    queues[side]->enqueue(Coordinate(x, y));
+    waiting[side]++;
+}
+
+/**
+ * @brief Solve the maze given by `maze`.
+ *
+ * @param[in] maze MazeGrid object that stores the maze to be
+ * solved.
+ */
+void BidirectionalBFSSolver::solve(MazeGrid *maze)
+{
+    int width = maze->get_width(), height = maze->get_height();
+    origins[0] = Coordinate(MAZE_START_X, MAZE_START_Y);
+    origins[1] = Coordinate(width - 1, height - 1);
+    met = false;
+    expanded = 0;
+
+    for (int side = 0; side < 2; side++)
+    {
+        visited[side].resize(width, height);
+        from_low[side].resize(width, height);
+        from_high[side].resize(width, height);
+        waiting[side] = 0;
+    }
+
+    visit(0, origins[0].x, origins[0].y, 0);
+    if (origins[0].x == origins[1].x && origins[0].y == origins[1].y)
+    {
+        /* A one-cell maze: the start is the end. */
+        current = origins[0];
+        meeting[0] = meeting[1] = current;
+        met = true;
+        return;
+    }
+    visit(1, origins[1].x, origins[1].y, 0);
+
+    while (waiting[0] > 0 && waiting[1] > 0)
+    {
+        /* Expand one whole level of the side with fewer cells waiting. */
+        int side = waiting[1] < waiting[0], other = side ^ 1;
+        long level = waiting[side];
+        waiting[side] = 0;
+        current_side = side;
+
+        for (long n = 0; n < level; n++)
+        {
+            current = queues[side]->dequeue();
+            int dir = maze->get_possible_moves(current.x, current.y);
+            expanded++;
+
+            for (int i = 0; i < 4; i++)
+            {
+                int nx = current.x + dx[i], ny = current.y + dy[i];
+                if (!(dir & directions[i]) || visited[side].get(nx, ny))
+                    continue;
+
+                if (visited[other].get(nx, ny))
+                {
+                    /* The searches have met. */
+                    meeting[side] = current;
+                    meeting[other] = Coordinate(nx, ny);
+                    met = true;
+#ifndef HEADLESS
+                    printf("COMPLETED THE MAZE!!!\n");
+#endif
+                    return;
+                }
+                visit(side, nx, ny, i ^ 1);
+            }
+        }
+    }
+    current = Coordinate(-1, -1);
+}
+
+/**
+ * @brief Appends the cells from c back to side's first cell to list.
+ */
+void BidirectionalBFSSolver::trace(int side, Coordinate c,
+    vector<Coordinate> &list)
+{
+    list.push_back(c);
+    while (c.x != origins[side].x || c.y != origins[side].y)
+    {
+        int back = from_low[side].get(c.x, c.y)
+            | (from_high[side].get(c.x, c.y) << 1);
+        c = Coordinate(c.x + dx[back], c.y + dy[back]);
+        list.push_back(c);
+    }
+}
+
+/**
+ * @brief Retrieves the current path through the maze.
+ *
+ * @return Vector storing the current path through the maze: from the
+ * end back to the start once solved, and until then from the cell being
+ * expanded back to the first cell of its side.
+ */
+vector<Coordinate> BidirectionalBFSSolver::get_path()
+{
+    vector<Coordinate> list;
+
+    if (met)
+    {
+        /* From the end to where the searches met, then on to the
+           start. */
+        if (meeting[0].x == meeting[1].x && meeting[0].y == meeting[1].y)
+        {
+            list.push_back(meeting[0]);
+            return list;
+        }
+        trace(1, meeting[1], list);
+        reverse(list.begin(), list.end());
+        trace(0, meeting[0], list);
+    }
+    else if (current.x != -1 || current.y != -1)
+    {
+        trace(current_side, current, list);
+    }
+    return list;
+}
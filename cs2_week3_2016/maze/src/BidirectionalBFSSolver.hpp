@@ -0,0 +1,61 @@
+/**
+ * @file BidirectionalBFSSolver.hpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Definitions for bidirectional breadth-first maze solver class.
+ */
+
+#ifndef __BIDIRECTIONALBFSSOLVER_H__
+#define __BIDIRECTIONALBFSSOLVER_H__
+
+#include <cstdio>
+#include <vector>
+#include "MazeSolverBase.hpp"
+#include "CoordinateQueue.hpp"
+
+/**
+ * @brief Encapsulates a bidirectional breadth-first maze solver.
+ *
+ * Two breadth-first searches run at once, one from the start and one
+ * from the end, a level at a time, each time on whichever side has the
+ * fewer cells waiting; they stop when a cell one of them reaches has
+ * already been reached by the other. A plain breadth-first search looks
+ * at every cell that is closer to the start than the end is; the two
+ * searches together only look at the cells about half as close to
+ * either end.
+ *
+ * Each side has its own visited bitmap and, like the breadth-first
+ * solver, two bitmaps for the direction each cell was reached from.
+ */
+class BidirectionalBFSSolver : public MazeSolverBase
+{
+public:
+    BidirectionalBFSSolver(class MazeSolverApp *app);
+    ~BidirectionalBFSSolver();
+
+    void solve(MazeGrid *maze);
+    vector<Coordinate> get_path();
+
+private:
+    /* Side 0 searches from the start, side 1 from the end. */
+    class CoordinateQueue *queues[2];
+    long waiting[2];
+    CellBitmap visited[2];
+    /* The direction back towards each side's first cell, as an index
+       into {N, S, E, W}: bit 0 in from_low, bit 1 in from_high. */
+    CellBitmap from_low[2], from_high[2];
+    Coordinate origins[2];
+    /* The cell being expanded, and its side; once the searches meet,
+       the two cells, each reached by its own side, where they met. */
+    Coordinate current;
+    int current_side;
+    bool met;
+    Coordinate meeting[2];
+
+    void visit(int side, int x, int y, int back);
+    void trace(int side, Coordinate c, vector<Coordinate> &list);
+};
+
+#endif
@@ -61,12 +61,8 @@ BreadthFirstSolver::BreadthFirstSolver(class MazeSolverApp *app)
  */
 void BreadthFirstSolver::init()
 {
-	// Set the visited parameter for each of the coordinates to false
-    for(int i = 0; i < WIDTH; i++) {
-		for(int j = 0; j < HEIGHT; j++) {
-			visited[i][j].visited = false;
-		}
-	}	
+	// The bitmaps are sized (with every cell unvisited) once solve()
+	// knows how big the maze is
 }
 
 /**
@@ -86,6 +82,28 @@ void BreadthFirstSolver::deinit()
     // Nothing needs to be done here
 }
 
+/**
+ * @brief Directions in the order of the index stored in from_low and
+ * from_high, and the steps they take.
+ */
+static const int directions[] = {N, S, E, W};
+static const int dx[] = {0, 0, 1, -1};
+static const int dy[] = {-1, 1, 0, 0};
+
+/**
+ * @brief Marks (x, y) visited, remembers that the cell it was reached
+ * from is in direction directions[back], and enqueues it.
+ */
+void BreadthFirstSolver::visit(int x, int y, int back)
+{
+	visited.set(x, y);
+	if (back & 1)
+		from_low.set(x, y);
+	if (back & 2)
+		from_high.set(x, y);
+	queue->enqueue(Coordinate(x, y));
+}
+
 /**
  * @brief Solve the maze given by `maze`.
  *
@@ -94,54 +112,43 @@ void BreadthFirstSolver::deinit()
  */
 void BreadthFirstSolver::solve(MazeGrid *maze)
 {
-	// Add the start point of the maze to the queue
-	visited[MAZE_START_X][MAZE_START_Y].visited = true;
-	visited[MAZE_START_X][MAZE_START_Y].from = Coordinate(-1, -1);
-    queue->enqueue(Coordinate(MAZE_START_X, MAZE_START_Y));
-    // We should save what was the coordinate we went from to get
-    // to each point, and this point will be stored in before.
-    // To know what was the start point, the from parameter of the
-    // starting coordinate is (-1, -1)
-    Coordinate before = Coordinate(-1, -1);
-    while(!queue->is_empty()) {
+	int width = maze->get_width(), height = maze->get_height();
+	visited.resize(width, height);
+	from_low.resize(width, height);
+	from_high.resize(width, height);
+	expanded = 0;
+
+	// Add the start point of the maze to the queue; its direction is
+	// never read, since get_path stops there
+	visit(MAZE_START_X, MAZE_START_Y, 0);
+	while(!queue->is_empty()) {
 		// Peek at the coordinate in the front of the queue
 		Coordinate c = queue->peek();
-		visited[c.x][c.y].visited = true;
-		before = c;
 		// If this coordinate is the end point fo the maze, we are done
-		if (c.x == MAZE_END_X && c.y == MAZE_END_Y) {
+		if (c.x == width - 1 && c.y == height - 1) {
+#ifndef HEADLESS
 			printf("COMPLETED THE MAZE!!!\n");
+#endif
 			return;
 		}
-		else {
-			// Get all the possible moves and check if this includes
-			// north, south, west, east. If each of this directions is
-			// ok, the coordinate that goes in that direction is
-			// enqueued to be checked later.
-			int dir = maze->get_possible_moves(c.x, c.y);
-			if ((dir & N) && !(visited[c.x][c.y-1].visited)) {
-				visited[c.x][c.y-1].from = before;
-				queue->enqueue(Coordinate(c.x, c.y - 1));
-			}
-			if ((dir & S) && !(visited[c.x][c.y+1].visited)) {
-				visited[c.x][c.y+1].from = before;
-				queue->enqueue(Coordinate(c.x, c.y + 1));
-			}
-			if ((dir & E) && !(visited[c.x+1][c.y].visited)) {
-				visited[c.x+1][c.y].from = before;
-				queue->enqueue(Coordinate(c.x + 1, c.y));
-			}
-			if ((dir & W) && !(visited[c.x-1][c.y].visited)) {
-				visited[c.x-1][c.y].from = before;
-				queue->enqueue(Coordinate(c.x - 1, c.y));
+		// Get all the possible moves, and enqueue the coordinate in
+		// each direction that is open and not yet visited, to be
+		// checked later. Cells are marked visited when they are
+		// enqueued, so none is enqueued twice. The cell they came from
+		// is in the opposite direction (index i ^ 1).
+		int dir = maze->get_possible_moves(c.x, c.y);
+		expanded++;
+		for (int i = 0; i < 4; i++) {
+			int nx = c.x + dx[i], ny = c.y + dy[i];
+			if ((dir & directions[i]) && !visited.get(nx, ny)) {
+				visit(nx, ny, i ^ 1);
 			}
 		}
 		// Dequeue the coordinate we were just looking at
-		c = queue->dequeue();
-
-
+		queue->dequeue();
 	}
 }
+
 /**
  * @brief Retrieves the current path through the maze.
  *
@@ -151,12 +158,17 @@ vector<Coordinate> BreadthFirstSolver::get_path()
 {
     vector<Coordinate> list;
     Coordinate top = queue->peek();
-	// Goes to the from coordinate of each coordinate from the top of
-	// the queue to get the path taken to get to that point
-	while (top.x != -1 && top.y != -1) {
+	if (top.x == -1 && top.y == -1) {
+		return list;
+	}
+	// Goes to the coordinate each coordinate was reached from, from the
+	// top of the queue back to the start, to get the path taken to get to
+	// that point
+	list.push_back(top);
+	while (top.x != MAZE_START_X || top.y != MAZE_START_Y) {
+		int back = from_low.get(top.x, top.y) | (from_high.get(top.x, top.y) << 1);
+		top = Coordinate(top.x + dx[back], top.y + dy[back]);
 		list.push_back(top);
-		top = visited[top.x][top.y].from;
 	}
     return list;
 }
-
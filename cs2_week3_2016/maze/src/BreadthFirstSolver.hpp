@@ -51,21 +51,16 @@
 #include "MazeSolverBase.hpp"
 #include "CoordinateQueue.hpp"
 
-/**
- * @brief A struct for keeping up with both which cells we have visited
- * and how we got there; this is necessary because the queue does not
- * contain enough information to allow us to trace back a path!
- */
-struct vitem
-{
-    bool visited;
-    Coordinate from;
-};
-
 /**
  * @brief Encapsulates a breadth-first maze solver.
+ *
+ * The queue does not contain enough information to allow us to trace
+ * back a path, so for every cell the solver also keeps whether it has
+ * been visited and the direction of the cell it was reached from. Each
+ * is a bitmap (two for the direction), so a 10000 x 10000 maze needs
+ * about 38 MB for them.
  */
-class BreadthFirstSolver : MazeSolverBase
+class BreadthFirstSolver : public MazeSolverBase
 {
 public:
     BreadthFirstSolver(class MazeSolverApp *app);
@@ -75,12 +70,15 @@ public:
     vector<Coordinate> get_path();
 
 private:
-	Coordinate last;
     class CoordinateQueue *queue;
-    vitem visited[WIDTH][HEIGHT];
+    CellBitmap visited;
+    /* The direction back to the cell each cell was reached from, as an
+       index into {N, S, E, W}: bit 0 in from_low, bit 1 in from_high. */
+    CellBitmap from_low, from_high;
 
 	void init();
 	void deinit();
+	void visit(int x, int y, int back);
 };
 
 #endif
@@ -0,0 +1,145 @@
+/**
+ * @file CellBitmap.hpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Definitions for a bitmap with one bit per cell of a maze.
+ */
+
+#ifndef __CELLBITMAP_H__
+#define __CELLBITMAP_H__
+
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <new>
+
+/**
+ * @brief Size of a cache line; every row of a CellBitmap starts on one.
+ */
+#ifndef CELL_ROW_ALIGN
+#define CELL_ROW_ALIGN  (64)
+#endif
+
+/**
+ * @brief One bit per cell of a width x height grid, stored row by row.
+ *
+ * Each row is a whole number of cache lines, so a row never shares a
+ * line with the next one, and walking along a row (or stepping between
+ * rows) touches as few lines as it can. A 10000 x 10000 bitmap takes
+ * 12.8 MB.
+ */
+class CellBitmap
+{
+public:
+    /**
+     * @brief Makes an empty (0 x 0) bitmap; see resize().
+     */
+    CellBitmap()
+    {
+        words = NULL;
+        row_words = 0;
+        height = 0;
+    }
+
+    /**
+     * @brief Makes a width x height bitmap with every bit clear.
+     */
+    CellBitmap(int width, int height)
+    {
+        words = NULL;
+        row_words = 0;
+        this->height = 0;
+        resize(width, height);
+    }
+
+    ~CellBitmap()
+    {
+        free(words);
+    }
+
+    /**
+     * @brief Makes the bitmap width x height, with every bit clear.
+     */
+    void resize(int width, int height)
+    {
+        const size_t line_words = CELL_ROW_ALIGN / sizeof(uint64_t);
+        size_t new_row_words = ((size_t) width + 63) / 64;
+        new_row_words = (new_row_words + line_words - 1) / line_words
+            * line_words;
+        if (new_row_words * height != row_words * this->height)
+        {
+            free(words);
+            words = NULL;
+            if (new_row_words * height > 0 && posix_memalign(
+                (void **) &words, CELL_ROW_ALIGN,
+                new_row_words * height * sizeof(uint64_t)) != 0)
+            {
+                throw std::bad_alloc();
+            }
+        }
+        row_words = new_row_words;
+        this->height = height;
+        clear();
+    }
+
+    /**
+     * @brief Clears every bit.
+     */
+    void clear()
+    {
+        if (words != NULL)
+        {
+            memset(words, 0, bytes());
+        }
+    }
+
+    /**
+     * @brief Returns the bit for cell (x, y).
+     */
+    bool get(int x, int y) const
+    {
+        return (words[word(x, y)] >> (x & 63)) & 1;
+    }
+
+    /**
+     * @brief Sets the bit for cell (x, y).
+     */
+    void set(int x, int y)
+    {
+        words[word(x, y)] |= (uint64_t) 1 << (x & 63);
+    }
+
+    /**
+     * @brief Clears the bit for cell (x, y).
+     */
+    void reset(int x, int y)
+    {
+        words[word(x, y)] &= ~((uint64_t) 1 << (x & 63));
+    }
+
+    /**
+     * @brief Number of bytes the bitmap takes.
+     */
+    size_t bytes() const
+    {
+        return row_words * height * sizeof(uint64_t);
+    }
+
+private:
+    uint64_t *words;
+    size_t row_words;
+    int height;
+
+    size_t word(int x, int y) const
+    {
+        return (size_t) y * row_words + (x >> 6);
+    }
+
+    // A bitmap owns its words, so it is not copied
+    CellBitmap(const CellBitmap &);
+    CellBitmap &operator=(const CellBitmap &);
+};
+
+#endif
@@ -71,10 +71,7 @@ CoordinateQueue::CoordinateQueue()
  */
 void CoordinateQueue::init()
 {
-	// To initialize the queue, set the front and rear node pointers
-	// to null
-   front = NULL;
-   rear = NULL;
+	// The ring starts out empty, so there is nothing to do
 }
 
 /**
@@ -90,20 +87,7 @@ CoordinateQueue::~CoordinateQueue()
  */
 void CoordinateQueue::deinit()
 {
-	// If the queue is empty, there is no allocated memory we need to
-	// free
-	if (is_empty()) {
-		return;
-	}
-	// Delete each node in the linked list, keeping a pointer to the
-	// next node while deleting the current node
-    queueitem *head = front;
-    queueitem *toDel;
-    while (head != NULL) {
-		toDel = head;
-		head = head->next;
-		delete toDel;
-	}
+	// The ring frees its own memory
 }
 
 /**
@@ -116,7 +100,7 @@ void CoordinateQueue::enqueue(Coordinate c)
 {
     /* Do the operation. */
     do_enqueue(c);
-#ifndef TESTSUITE
+#ifdef MAZE_ANIMATE
     /* Update the display, if necessary. */
     SDL_Delay(ANIMATION_DELAY);
     this->app->OnRender();
@@ -130,24 +114,9 @@ void CoordinateQueue::enqueue(Coordinate c)
  */
 void CoordinateQueue::do_enqueue(Coordinate c)
 {
-	// If the queue is empty, the front and rear pointers need
-	// to be initialized, and since there will be one element, the
-	// front and rear element are the same
-    if (is_empty()) {
-		front = new queueitem;
-		front->c = c;
-		front->next = NULL;
-		rear = front;
-	}
-	// Otherwise, intialize the new last element and connect the previous
-	// rear element to the new one
-	else {
-		queueitem *oldLast = rear;
-		rear = new queueitem;
-		rear->c = c;
-		rear->next = NULL;
-		oldLast->next = rear;	
-	}
+	// Add the coordinate at the back of the ring, which grows if it is
+	// full
+    items.push(c);
 }
 
 /**
@@ -170,15 +139,8 @@ Coordinate CoordinateQueue::dequeue()
 Coordinate CoordinateQueue::do_dequeue()
 {
 	// If the queue is empty, return the predefined coordinate (-1, -1)
-    if (is_empty()) {
-		return Coordinate(-1, -1);
-	}    
-	// Save the front coordinate to return and change the front to the
-	// second node, and also deallocate the memory for the popped node
-    queueitem *oldFront = front;
-    Coordinate c = oldFront->c;
-    front = oldFront->next;
-    delete oldFront;
+    Coordinate c(-1, -1);
+    items.pop(c);
     return c;
 }
 
@@ -194,7 +156,7 @@ Coordinate CoordinateQueue::peek()
 	if (is_empty()) {
 		return Coordinate(-1, -1);
 	}
-    return front->c;
+    return items.front();
 }
 
 /**
@@ -204,7 +166,5 @@ Coordinate CoordinateQueue::peek()
  */
 bool CoordinateQueue::is_empty()
 {
-	// If the queue is empty, the front node is NULL
-    return front == NULL;
+    return items.empty();
 }
-
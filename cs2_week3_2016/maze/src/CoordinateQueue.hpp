@@ -48,24 +48,22 @@
 
 #include <cstdlib>
 #include "common.hpp"
+#include "RingQueue.hpp"
 
 using namespace std;
 
-/**
- * @brief Simple queue item for Coordinate objects.
- */
-struct queueitem {
-    Coordinate c;
-    queueitem *next;
-};
-
 #ifndef TESTSUITE
 #include "MazeSolverBase.hpp"
+#endif
+#ifdef MAZE_ANIMATE
 #include "MazeSolverApp.hpp"
 #endif
 
 /**
  * @brief Encapsulates a queue for Coordinate objects.
+ *
+ * The Coordinates are kept in a RingQueue, so enqueuing and dequeuing
+ * do not allocate once the ring is as big as the queue gets.
  */
 class CoordinateQueue
 {
@@ -83,7 +81,7 @@ public:
     bool is_empty();
 
 private:
-    queueitem *front, *rear;
+    RingQueue<Coordinate> items;
 
 #ifndef TESTSUITE
     class MazeSolverApp *app;
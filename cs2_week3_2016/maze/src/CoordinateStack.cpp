@@ -72,9 +72,7 @@ CoordinateStack::CoordinateStack()
  */
 void CoordinateStack::init()
 {
-	// We only need to initialize the top node to NULL, as there are 
-	// no elements
-    top = NULL;
+	// The vector starts out empty, so there is nothing to do
 }
 
 /**
@@ -90,20 +88,7 @@ CoordinateStack::~CoordinateStack()
  */
 void CoordinateStack::deinit()
 {
-	// If the stack is empty, there is no memory that has been
-	// allocated that still needs to be freed
-    if (is_empty()) {
-		return;
-	}
- 	// Delete each node in the linked list, keeping a pointer to the
-	// next node while deleting the current node
-    stackitem *head = top;
-    stackitem *toDel;
-	while (head != NULL) {
-		toDel = head;
-		head = head->next;
-		delete toDel;
-	}
+	// The vector frees its own memory
 }
 
 /**
@@ -116,7 +101,7 @@ void CoordinateStack::push(Coordinate c)
     /* Do the operation. */
     do_push(c);
 
-#ifndef TESTSUITE
+#ifdef MAZE_ANIMATE
     /* Update the display. */
     SDL_Delay(ANIMATION_DELAY);
     this->app->OnRender();
@@ -130,21 +115,8 @@ void CoordinateStack::push(Coordinate c)
  */
 void CoordinateStack::do_push(Coordinate c)
 {
-	// If the array is empty, the top node needs to be initialized
-    if (is_empty()) {
-		top = new stackitem;
-		top->next = NULL;
-		top->c = c;
-	}
-	// Otherwise, this new coordinate becomes the top node and the old
-	// top node is connected to the new top
-	else {
-		stackitem *oldFirst = new stackitem;
-		oldFirst->c = top->c;
-		oldFirst->next = top->next;
-		top->c = c;
-		top->next = oldFirst;
-	}
+	// The top of the stack is the back of the vector
+    items.push_back(c);
 }
 
 /**
@@ -157,7 +129,7 @@ Coordinate CoordinateStack::pop()
     /* Do the operation. */
     Coordinate c = do_pop();
 
-#ifndef TESTSUITE
+#ifdef MAZE_ANIMATE
     /* Update the display. */
     SDL_Delay(ANIMATION_DELAY);
     this->app->OnRender();
@@ -179,12 +151,8 @@ Coordinate CoordinateStack::do_pop()
 		Coordinate c(-1, -1);
 		return c;
 	}
-	// Save the top coordinate to return and change the top to the
-	// second node, and also deallocate the memory for the popped node
-	stackitem *oldFirst = top;
-    Coordinate c = oldFirst->c;
-    top = oldFirst->next;
-    delete oldFirst;
+    Coordinate c = items.back();
+    items.pop_back();
     return c;
 }
 
@@ -199,7 +167,7 @@ Coordinate CoordinateStack::peek()
 	if (is_empty()) {
 		return Coordinate(-1, -1);
 	}
-    return top->c;
+    return items.back();
 }
 
 /**
@@ -209,8 +177,7 @@ Coordinate CoordinateStack::peek()
  */
 bool CoordinateStack::is_empty()
 {
-	// If the top node is null, there are no nodes in the stack
-    return top == NULL;
+    return items.empty();
 }
 
 /**
@@ -220,11 +187,6 @@ bool CoordinateStack::is_empty()
  * @param[in] list Vector in which to store the coordinates.
  */
 void CoordinateStack::traverse(vector<Coordinate> &list) {
-	// Create another pointer to the top of the stack so the top pointer
-	// is not moved
-	stackitem *head = top;
-	while(head != NULL) {
-		list.push_back(head->c);
-		head = head->next;
-	}
+	// From the top of the stack down
+	list.insert(list.end(), items.rbegin(), items.rend());
 }
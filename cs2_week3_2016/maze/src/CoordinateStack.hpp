@@ -52,21 +52,19 @@
 
 using namespace std;
 
-/**
- * @brief Simple stack item for Coordinate objects.
- */
-struct stackitem {
-    Coordinate c;
-    stackitem *next;
-};
-
 #ifndef TESTSUITE
 #include "MazeSolverBase.hpp"
+#endif
+#ifdef MAZE_ANIMATE
 #include "MazeSolverApp.hpp"
 #endif
 
 /**
  * @brief Encapsulates a stack for Coordinate objects.
+ *
+ * The Coordinates are kept in a vector, 8 bytes each, rather than in a
+ * node apiece, since a depth-first search of a large maze can have
+ * millions of them on the stack at once.
  */
 class CoordinateStack
 {
@@ -85,7 +83,7 @@ public:
     void traverse(vector<Coordinate> &list);
 
 private:
-    stackitem *top;
+    vector<Coordinate> items;
 
 #ifndef TESTSUITE
     class MazeSolverApp *app;
@@ -61,12 +61,8 @@ DepthFirstSolver::DepthFirstSolver(class MazeSolverApp *app)
  */
 void DepthFirstSolver::init()
 {
-	// Initialize each coordinate in the visited array to not visited
-    for (int i = 0; i < WIDTH; i++) {
-		for (int j = 0; j < HEIGHT; j++) {
-			visited[i][j] = false;
-		}
-	}
+	// The visited bitmap is sized (with every cell unvisited) once
+	// solve() knows how big the maze is
 }
 
 /**
@@ -95,15 +91,20 @@ void DepthFirstSolver::deinit()
  */
 void DepthFirstSolver::solve(MazeGrid *maze)
 {
+	int width = maze->get_width(), height = maze->get_height();
+	visited.resize(width, height);
+	expanded = 0;
+
 	// Push the first starting point onto the stack
 	stack->push(Coordinate(MAZE_START_X, MAZE_START_Y));
 	while(!stack->is_empty()) {
 		// Peek at the top coordinate of the stack
 		Coordinate c = stack->peek();
-		visited[c.x][c.y] = true;
 		// If this coordinate is the end point, then we are done
-		if (c.x == MAZE_END_X && c.y == MAZE_END_Y) {
+		if (c.x == width - 1 && c.y == height - 1) {
+#ifndef HEADLESS
 			printf("COMPLETED THE MAZE!!!\n");
+#endif
 			return;
 		}
 		else {
@@ -111,6 +112,12 @@ void DepthFirstSolver::solve(MazeGrid *maze)
 			// coordinates of these movements onto the stack
 			int dir = maze->get_possible_moves(c.x, c.y);
 			bool canMove = false;
+			// A cell is expanded when it first comes to the top; it
+			// comes back to the top after each dead end below it
+			if (!visited.get(c.x, c.y)) {
+				visited.set(c.x, c.y);
+				expanded++;
+			}
 			
 			/** FIXED VISUALIZATION ISSUE WITH DFS MAZE WHERE SOME DIAGONALS
 			 *  AND WEIRD PATHS WERE SHOWN BY CHANGING A SEQUENCE OF FOUR
@@ -123,19 +130,19 @@ void DepthFirstSolver::solve(MazeGrid *maze)
 			 *  FROM ONE TO ANOTHER, LEADING TO WEIRD DIAGONALS OR MOVING
 			 *  NORTH/SOUTH RIGHT AFTER EACH OTHER
 			 */
-			if ((dir & N) && !visited[c.x][c.y-1]) {
+			if ((dir & N) && !visited.get(c.x, c.y - 1)) {
 				stack->push(Coordinate(c.x, c.y - 1));
 				canMove = true;
 			}
-			else if ((dir & S) && !visited[c.x][c.y+1]) {
+			else if ((dir & S) && !visited.get(c.x, c.y + 1)) {
 				stack->push(Coordinate(c.x, c.y + 1));
 				canMove = true;
 			}
-			else if ((dir & E) && !visited[c.x+1][c.y]) {
+			else if ((dir & E) && !visited.get(c.x + 1, c.y)) {
 				stack->push(Coordinate(c.x + 1, c.y));
 				canMove = true;
 			}
-			else if ((dir & W) && !visited[c.x-1][c.y]) {
+			else if ((dir & W) && !visited.get(c.x - 1, c.y)) {
 				stack->push(Coordinate(c.x - 1, c.y));
 				canMove = true;
 			}
@@ -54,7 +54,7 @@
 /**
  * @brief Encapsulates a depth-first maze solver.
  */
-class DepthFirstSolver : MazeSolverBase
+class DepthFirstSolver : public MazeSolverBase
 {
 public:
     DepthFirstSolver(class MazeSolverApp *app);
@@ -65,7 +65,7 @@ public:
 
 private:
     class CoordinateStack *stack;
-    bool visited[WIDTH][HEIGHT];
+    CellBitmap visited;
 
     void init();
     void deinit();
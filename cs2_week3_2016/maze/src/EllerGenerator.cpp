@@ -0,0 +1,134 @@
+/**
+ * @file EllerGenerator.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Functions for maze generator that uses Eller's algorithm.
+ */
+#include "EllerGenerator.hpp"
+
+/**
+ * @brief Initializes the maze generator.
+ *
+ * @param[in] width Width of the mazes to generate, in cells.
+ * @param[in] height Height of the mazes to generate, in cells.
+ * @param[in] seed Seed for the random choices; the same seed gives the
+ * same mazes.
+ */
+EllerGenerator::EllerGenerator(int width, int height, uint64_t seed)
+    : random(seed)
+{
+    maze = new MazeGrid(width, height);
+}
+
+/**
+ * @brief Deinitializes the maze generator.
+ */
+EllerGenerator::~EllerGenerator()
+{
+    delete maze;
+}
+
+/**
+ * @brief Creates a maze, replacing the last one.
+ */
+void EllerGenerator::create_maze()
+{
+    maze->init();
+    generate_rows(maze->width, maze->height, NULL);
+}
+
+/**
+ * @brief Makes a width x height maze, a row at a time, and hands each
+ * row to sink, or carves it into the generator's own maze if sink is
+ * NULL.
+ *
+ * @param[in] width Width of the maze, in cells.
+ * @param[in] height Height of the maze, in cells; with a sink, it can
+ * be as large as a `long` can hold.
+ * @param[in] sink Where to send the rows.
+ */
+void EllerGenerator::generate_rows(int width, long height, MazeRowSink *sink)
+{
+    int x;
+    long y;
+
+    left.resize(width);
+    right.resize(width);
+    east.resize(width);
+    south.resize(width);
+
+    /* Every cell of the first row is in a set of its own. */
+    for (x = 0; x < width; x++)
+    {
+        left[x] = x;
+        right[x] = x;
+    }
+
+    for (y = 0; y < height; y++)
+    {
+        bool last = (y == height - 1);
+
+        for (x = 0; x < width; x++)
+        {
+            east[x] = 0;
+            south[x] = 0;
+
+            /* Join x's set with x + 1's, at random, unless they are
+               already the same set; in the last row, join every set, so
+               that the maze is connected. */
+            if (x + 1 < width && right[x] != x + 1 && (last || random.coin()))
+            {
+                left[right[x]] = left[x + 1];
+                right[left[x + 1]] = right[x];
+                right[x] = x + 1;
+                left[x + 1] = x;
+                east[x] = 1;
+            }
+
+            if (last)
+                continue;
+
+            /* Carve south at random, but always from the last cell of a
+               set that has not carved south yet, so that every set goes
+               on to the next row. A cell that does not carve south
+               leaves its set; the cell below it starts a set of its
+               own. */
+            if (right[x] == x || random.coin())
+            {
+                south[x] = 1;
+            }
+            else
+            {
+                left[right[x]] = left[x];
+                right[left[x]] = right[x];
+                left[x] = x;
+                right[x] = x;
+            }
+        }
+
+        if (sink != NULL)
+        {
+            sink->add_row(y, east, south);
+            continue;
+        }
+        for (x = 0; x < width; x++)
+        {
+            if (east[x])
+                maze->carve(x, y, E);
+            if (south[x])
+                maze->carve(x, y, S);
+        }
+    }
+}
+
+/**
+ * @brief Returns the generated maze.
+ *
+ * @return Maze as a MazeGrid object.
+ */
+MazeGrid *EllerGenerator::get_maze()
+{
+    return maze;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file EllerGenerator.hpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Definitions for maze generator that uses Eller's algorithm.
+ */
+
+#ifndef __ELLERGENERATOR_H__
+#define __ELLERGENERATOR_H__
+
+#include <ctime>
+#include <vector>
+#include "MazeGrid.hpp"
+#include "MazeGeneratorBase.hpp"
+#include "MazeRandom.hpp"
+
+using namespace std;
+
+/**
+ * @brief Receives a maze one row at a time, from EllerGenerator.
+ */
+class MazeRowSink
+{
+public:
+    virtual ~MazeRowSink() { };
+
+    /**
+     * @brief Takes row y of the maze: east[x] is nonzero if there is a
+     * passage from (x, y) to (x + 1, y), and south[x] if there is one
+     * from (x, y) to (x, y + 1).
+     */
+    virtual void add_row(long y, const vector<char> &east,
+        const vector<char> &south) = 0;
+};
+
+/**
+ * @brief Encapsulates a maze generator that uses Eller's algorithm.
+ *
+ * Eller's algorithm makes a maze one row at a time, and only needs to
+ * know which cells of the current row are already connected to each
+ * other (by way of the rows above), so it can make a maze of any height
+ * in memory proportional to its width; generate_rows() hands each row
+ * to a MazeRowSink as it is finished and never keeps more than one.
+ *
+ * The cells connected to each other form sets, and a set's cells are
+ * kept in a circular list (left and right) in the order of their
+ * columns. Two sets in a row never cross (if a < b < c < d, a and c in
+ * one set and b and d in another, their paths would have to cross), so
+ * x and x + 1 are in the same set exactly when x + 1 comes right after
+ * x in its list, and sets are joined or left in constant time.
+ */
+class EllerGenerator : public MazeGeneratorBase
+{
+public:
+    EllerGenerator(int width = WIDTH, int height = HEIGHT,
+        uint64_t seed = time(NULL));
+    ~EllerGenerator();
+
+    void create_maze();
+    MazeGrid *get_maze();
+    void generate_rows(int width, long height, MazeRowSink *sink);
+
+private:
+    MazeGrid *maze;
+    MazeRandom random;
+    /* The current row: each cell's neighbors in its set's list, and its
+       passages east and south. */
+    vector<int> left, right;
+    vector<char> east, south;
+};
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * @file KruskalGenerator.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Functions for maze generator that uses Kruskal's algorithm.
+ */
+#include "KruskalGenerator.hpp"
+
+/**
+ * @brief Initializes the maze generator.
+ *
+ * @param[in] width Width of the mazes to generate, in cells.
+ * @param[in] height Height of the mazes to generate, in cells.
+ * @param[in] seed Seed for the random choices; the same seed gives the
+ * same mazes.
+ */
+KruskalGenerator::KruskalGenerator(int width, int height, uint64_t seed)
+    : random(seed)
+{
+    maze = new MazeGrid(width, height);
+}
+
+/**
+ * @brief Deinitializes the maze generator.
+ */
+KruskalGenerator::~KruskalGenerator()
+{
+    delete maze;
+}
+
+/**
+ * @brief Returns the root of the tree that cell is in, halving the path
+ * to it on the way.
+ */
+uint32_t KruskalGenerator::find(uint32_t cell)
+{
+    while (parent[cell] != cell)
+    {
+        parent[cell] = parent[parent[cell]];
+        cell = parent[cell];
+    }
+    return cell;
+}
+
+/**
+ * @brief Creates a maze, replacing the last one.
+ */
+void KruskalGenerator::create_maze()
+{
+    uint32_t width = maze->width, height = maze->height;
+    uint32_t cells = width * height, carved = 0;
+    uint32_t i, j;
+
+    maze->init();
+    parent.resize(cells);
+    rank.assign(cells, 0);
+    for (i = 0; i < cells; i++)
+        parent[i] = i;
+
+    walls.clear();
+    walls.reserve(2 * cells);
+    for (i = 0; i < cells; i++)
+    {
+        if (i % width + 1 < width)
+            walls.push_back(2 * i);
+        if (i / width + 1 < height)
+            walls.push_back(2 * i + 1);
+    }
+
+    /* Fisher-Yates shuffle. */
+    for (i = walls.size(); i > 1; i--)
+    {
+        j = random.below(i);
+        uint32_t wall = walls[i - 1];
+        walls[i - 1] = walls[j];
+        walls[j] = wall;
+    }
+
+    /* A spanning tree of the cells has cells - 1 passages, so the walls
+       after the last of them can all stay. */
+    for (i = 0; i < walls.size() && carved + 1 < cells; i++)
+    {
+        uint32_t cell = walls[i] / 2;
+        bool is_south = walls[i] & 1;
+        uint32_t a = find(cell);
+        uint32_t b = find(is_south ? cell + width : cell + 1);
+
+        if (a == b)
+            continue;
+
+        /* Union by rank: the shallower tree goes under the deeper. */
+        if (rank[a] < rank[b])
+        {
+            parent[a] = b;
+        }
+        else
+        {
+            parent[b] = a;
+            if (rank[a] == rank[b])
+                rank[a]++;
+        }
+        maze->carve(cell % width, cell / width, is_south ? S : E);
+        carved++;
+    }
+
+    /* The forest and walls are only needed while generating. */
+    vector<uint32_t>().swap(parent);
+    vector<uint8_t>().swap(rank);
+    vector<uint32_t>().swap(walls);
+}
+
+/**
+ * @brief Returns the generated maze.
+ *
+ * @return Maze as a MazeGrid object.
+ */
+MazeGrid *KruskalGenerator::get_maze()
+{
+    return maze;
+}
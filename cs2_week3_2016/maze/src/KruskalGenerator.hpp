@@ -0,0 +1,57 @@
+/**
+ * @file KruskalGenerator.hpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Definitions for maze generator that uses Kruskal's algorithm.
+ */
+
+#ifndef __KRUSKALGENERATOR_H__
+#define __KRUSKALGENERATOR_H__
+
+#include <ctime>
+#include <vector>
+#include "MazeGrid.hpp"
+#include "MazeGeneratorBase.hpp"
+#include "MazeRandom.hpp"
+
+using namespace std;
+
+/**
+ * @brief Encapsulates a maze generator that uses Kruskal's algorithm.
+ *
+ * Kruskal's algorithm goes through every wall in a random order, and
+ * knocks a wall down if the cells on its two sides are not yet connected,
+ * which it finds out with a union-find forest over the cells. The mazes
+ * have many short dead ends.
+ *
+ * It needs about 13 bytes per cell while generating (a 32-bit parent and
+ * a rank for each cell, and two 32-bit walls), so a maze can have at most 2^31
+ * cells.
+ */
+class KruskalGenerator : public MazeGeneratorBase
+{
+public:
+    KruskalGenerator(int width = WIDTH, int height = HEIGHT,
+        uint64_t seed = time(NULL));
+    ~KruskalGenerator();
+
+    void create_maze();
+    MazeGrid *get_maze();
+
+private:
+    MazeGrid *maze;
+    MazeRandom random;
+    /* Each cell's parent in the forest; a root's parent is itself. */
+    vector<uint32_t> parent;
+    /* An upper bound on the height of each root's tree. */
+    vector<uint8_t> rank;
+    /* The walls, as 2 * cell for a cell's east wall and 2 * cell + 1
+       for its south wall. */
+    vector<uint32_t> walls;
+
+    uint32_t find(uint32_t cell);
+};
+
+#endif
@@ -0,0 +1,40 @@
+/**
+ * @file MazeGeneratorBase.hpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Definitions for all maze generator classes.
+ */
+
+#ifndef __MAZEGENERATORBASE_H__
+#define __MAZEGENERATORBASE_H__
+
+#include "MazeGrid.hpp"
+
+/**
+ * @brief Abstract class defining functions that all maze generators
+ * must implement.
+ *
+ * Every generator makes perfect mazes (exactly one path between any two
+ * cells) of the size it was constructed with, from a seed, so that the
+ * same seed always gives the same maze.
+ */
+class MazeGeneratorBase
+{
+public:
+    /**
+     * @brief Initializes the generator.
+     */
+    MazeGeneratorBase() { };
+
+    /**
+     * @brief Deinitializes the generator.
+     */
+    virtual ~MazeGeneratorBase() { };
+
+    virtual void create_maze() = 0;
+    virtual MazeGrid *get_maze() = 0;
+};
+
+#endif
@@ -44,11 +44,16 @@
  */
 
 #include "MazeGrid.hpp"
+#include "MazeRandom.hpp"
 
 /**
- * @brief Initializes the maze.
+ * @brief Initializes the maze, with every wall in place.
+ *
+ * @param[in] width Width of the maze, in cells.
+ * @param[in] height Height of the maze, in cells.
  */
-MazeGrid::MazeGrid()
+MazeGrid::MazeGrid(int width, int height)
+    : width(width), height(height), east(width, height), south(width, height)
 {
 
 }
@@ -69,26 +74,90 @@ MazeGrid::~MazeGrid()
  *
  * @param[in] x x-coordinate of the requested cell
  * @param[in] y y-coordinate of the requested cell
+ *
+ * @return The directions in {N, S, E, W} with no wall, or'd together.
  */
-int  MazeGrid::get_possible_moves(int x, int y)
+int MazeGrid::get_possible_moves(int x, int y) const
 {
-    return grid[x][y];
+    int moves = 0;
+
+    if (east.get(x, y))
+        moves |= E;
+    if (south.get(x, y))
+        moves |= S;
+    if (x > 0 && east.get(x - 1, y))
+        moves |= W;
+    if (y > 0 && south.get(x, y - 1))
+        moves |= N;
+
+    return moves;
 }
 
 
 /**
- * @brief Initializes/resets all maze cells.
+ * @brief Knocks down each wall between two cells with probability
+ * `fraction`, which opens loops in the maze, so that there is more than
+ * one way through it.
+ *
+ * @param[in] fraction Chance of each wall being knocked down, from 0
+ * (none) to 1 (an open field).
+ * @param[in] seed Seed for the random choices.
  */
-void MazeGrid::init()
+void MazeGrid::braid(double fraction, uint64_t seed)
 {
-    int x, y;
+    MazeRandom random(seed);
 
-    /* Initialize all cells to 0. */
-    for (x = 0; x < WIDTH; x++)
+    for (int y = 0; y < height; y++)
     {
-        for (y = 0; y < HEIGHT; y++)
+        for (int x = 0; x < width; x++)
         {
-            grid[x][y] = 0;
+            /* A uniform double in [0, 1) from the top 53 bits (over 2^53). */
+            if (x + 1 < width && (random.next() >> 11) / 9007199254740992.0 < fraction)
+                east.set(x, y);
+            if (y + 1 < height && (random.next() >> 11) / 9007199254740992.0 < fraction)
+                south.set(x, y);
         }
     }
 }
+
+
+/**
+ * @brief Removes the wall between (x, y) and the cell next to it in
+ * direction d, which must be inside the maze.
+ *
+ * @param[in] x x-coordinate of the cell
+ * @param[in] y y-coordinate of the cell
+ * @param[in] d A direction in {N, S, E, W}
+ */
+void MazeGrid::carve(int x, int y, int d)
+{
+    switch (d)
+    {
+        case E:
+            east.set(x, y);
+            break;
+
+        case W:
+            east.set(x - 1, y);
+            break;
+
+        case S:
+            south.set(x, y);
+            break;
+
+        case N:
+            south.set(x, y - 1);
+            break;
+    }
+}
+
+
+/**
+ * @brief Initializes/resets all maze cells.
+ */
+void MazeGrid::init()
+{
+    /* Put every wall back. */
+    east.clear();
+    south.clear();
+}
@@ -46,6 +46,9 @@
 #ifndef __MAZEGRID_H__
 #define __MAZEGRID_H__
 
+#include "CellBitmap.hpp"
+
+/* Default size of a maze. */
 #define WIDTH       (35)
 #define HEIGHT      (25)
 
@@ -58,20 +61,45 @@ using namespace std;
 
 /**
  * @brief Encapsulates a maze.
+ *
+ * The maze's size is chosen when it is made. Every wall between two
+ * cells is one bit, in one of two bitmaps: one for the walls to the east
+ * of the cells and one for the walls to their south (the walls to the
+ * west and north of a cell are the east and south walls of its
+ * neighbors). A 10000 x 10000 maze takes about 26 MB.
  */
 class MazeGrid
 {
 public:
-    MazeGrid();
+    MazeGrid(int width = WIDTH, int height = HEIGHT);
     ~MazeGrid();
 
-    int get_possible_moves(int x, int y);
+    int get_possible_moves(int x, int y) const;
+    void braid(double fraction, uint64_t seed);
+
+    /**
+     * @brief Returns the width of the maze, in cells.
+     */
+    int get_width() const { return width; }
+
+    /**
+     * @brief Returns the height of the maze, in cells.
+     */
+    int get_height() const { return height; }
 
     friend class RecursiveBacktracker;
+    friend class WilsonGenerator;
+    friend class EllerGenerator;
+    friend class KruskalGenerator;
     friend class MazeSolverApp;
 
 protected:
-    int grid[WIDTH][HEIGHT];
+    int width, height;
+    /* Bit (x, y) is set if there is a passage from (x, y) to (x + 1, y),
+       or, for south, to (x, y + 1). */
+    CellBitmap east, south;
+
+    void carve(int x, int y, int d);
 
 private:
     void init();
@@ -167,6 +167,33 @@ void MazeSolverApp::OnEvent(SDL_Event* event)
             solver->solve(maze);
             OnRender();
         }
+        else if (event->key.keysym.unicode == 'a')
+        {
+            /* Solve the maze with an A* search. */
+            if (solver)
+            {
+                delete solver;
+                solver = NULL;
+            }
+
+            solver = (MazeSolverBase *) new AStarSolver(this);
+            solver->solve(maze);
+            OnRender();
+        }
+        else if (event->key.keysym.unicode == 'm')
+        {
+            /* Solve the maze with breadth-first searches from both
+               ends that meet in the middle. */
+            if (solver)
+            {
+                delete solver;
+                solver = NULL;
+            }
+
+            solver = (MazeSolverBase *) new BidirectionalBFSSolver(this);
+            solver->solve(maze);
+            OnRender();
+        }
         else if (event->key.keysym.unicode == 'r')
         {
             /* Reset the maze. */
@@ -215,7 +242,7 @@ void MazeSolverApp::draw_maze()
     int x, y;
     int h = 0, w = 0;
 
-    for (x = 0; x < WIDTH * 2; x++)
+    for (x = 0; x < maze->width * 2; x++)
     {
         /* Horizontal line (top) */
         boxRGBA(surf, MAZE_X_OFFSET,
@@ -227,7 +254,7 @@ void MazeSolverApp::draw_maze()
 
     h++;
 
-    for (y = 0; y < HEIGHT; y++)
+    for (y = 0; y < maze->height; y++)
     {
         /* Vertical line (left) */
         if (y != 0)
@@ -240,9 +267,11 @@ void MazeSolverApp::draw_maze()
 
         w++;
 
-        for (x = 0; x < WIDTH; x++)
+        for (x = 0; x < maze->width; x++)
         {
-            if ((maze->grid[x][y] & S) != 0)
+            int moves = maze->get_possible_moves(x, y);
+
+            if ((moves & S) != 0)
             {
                 w++;
             }
@@ -257,10 +286,10 @@ void MazeSolverApp::draw_maze()
                 w++;
             }
 
-            if ((maze->grid[x][y] & E) != 0)
+            if ((moves & E) != 0)
             {
-                if (((maze->grid[x][y] |
-                    maze->grid[x+1][y]) & S) != 0)
+                if (((moves |
+                    maze->get_possible_moves(x + 1, y)) & S) != 0)
                 {
                     w++;
                 }
@@ -278,7 +307,7 @@ void MazeSolverApp::draw_maze()
             else
             {
                 /* Vertical line */
-                if ((x < WIDTH - 1) || (y < HEIGHT - 1))
+                if ((x < maze->width - 1) || (y < maze->height - 1))
                 {
                     boxRGBA(surf, w * MAZE_H_LENGTH + MAZE_X_OFFSET,
                         (h - 1) * MAZE_V_LENGTH + MAZE_Y_OFFSET,
@@ -54,6 +54,8 @@
 #include "MazeSolverBase.hpp"
 #include "DepthFirstSolver.hpp"
 #include "BreadthFirstSolver.hpp"
+#include "AStarSolver.hpp"
+#include "BidirectionalBFSSolver.hpp"
 
 #define SCREEN_WIDTH    (800)
 #define SCREEN_HEIGHT   (600)
@@ -60,7 +60,7 @@ public:
     /**
      * @brief Initializes the solver.
      */
-    MazeSolverBase() { };
+    MazeSolverBase() : expanded(0) { };
 
     /**
      * @brief Deinitializes the solver.
@@ -69,6 +69,15 @@ public:
 
     virtual void solve(MazeGrid *maze) = 0;
     virtual vector<Coordinate> get_path() = 0;
+
+    /**
+     * @brief Returns the number of cells the last solve() expanded, that
+     * is, took from its frontier and looked at the neighbors of.
+     */
+    long get_expanded() const { return expanded; }
+
+protected:
+    long expanded;
 };
 
 #endif
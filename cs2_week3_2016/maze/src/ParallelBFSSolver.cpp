@@ -0,0 +1,362 @@
+/**
+ * @file ParallelBFSSolver.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Functions for parallel breadth-first maze solver class.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include "ParallelBFSSolver.hpp"
+
+/* Cells of the frontier a thread takes at a time in a top-down step, and
+   words of the visited bitmap it takes at a time in a bottom-up one. */
+#define TOP_DOWN_CHUNK      (1024)
+#define BOTTOM_UP_CHUNK     (64)
+
+/**
+ * @brief Directions in the order of the index stored in from_low and
+ * from_high, and the steps they take.
+ */
+static const int directions[] = {N, S, E, W};
+static const int dx[] = {0, 0, 1, -1};
+static const int dy[] = {-1, 1, 0, 0};
+
+/**
+ * @brief Initializes the solver, with a pool of nthreads threads, or one
+ * per core if nthreads is 0.
+ */
+ParallelBFSSolver::ParallelBFSSolver(int nthreads)
+    : maze(NULL), width(0), height(0), end(0), found(false), nwords(0)
+{
+    if (nthreads < 1)
+        nthreads = std::thread::hardware_concurrency();
+    if (nthreads < 1)
+        nthreads = 1;
+    this->nthreads = nthreads;
+    next.resize(nthreads);
+    worker_claimed.resize(nthreads);
+
+    generation = 0;
+    running = 0;
+    stopping = false;
+    task = NULL;
+    for (int t = 1; t < nthreads; t++)
+        workers.push_back(std::thread(&ParallelBFSSolver::worker_loop, this, t));
+}
+
+/**
+ * @brief Deinitializes the solver, stopping the pool's threads.
+ */
+ParallelBFSSolver::~ParallelBFSSolver()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+        generation++;
+    }
+    wake.notify_all();
+    for (unsigned int t = 0; t < workers.size(); t++)
+        workers[t].join();
+}
+
+/**
+ * @brief Runs task on every thread of the pool, including this one as
+ * worker 0, and returns once they have all finished.
+ */
+void ParallelBFSSolver::run_on_all(void (ParallelBFSSolver::*task)(int worker))
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        this->task = task;
+        running = nthreads - 1;
+        generation++;
+    }
+    wake.notify_all();
+    (this->*task)(0);
+    std::unique_lock<std::mutex> guard(lock);
+    while (running > 0)
+        done.wait(guard);
+}
+
+/**
+ * @brief The loop each of the pool's threads runs until the solver goes
+ * away.
+ */
+void ParallelBFSSolver::worker_loop(int worker)
+{
+    unsigned long seen = 0;
+    std::unique_lock<std::mutex> guard(lock);
+    while (true)
+    {
+        while (generation == seen)
+            wake.wait(guard);
+        seen = generation;
+        if (stopping)
+            return;
+        void (ParallelBFSSolver::*current)(int) = task;
+        guard.unlock();
+        (this->*current)(worker);
+        guard.lock();
+        if (--running == 0)
+            done.notify_one();
+    }
+}
+
+/**
+ * @brief Runs one step: on every thread if parallel is set, or else on
+ * this one alone, which then does all of the work.
+ */
+void ParallelBFSSolver::run(void (ParallelBFSSolver::*task)(int worker),
+    bool parallel)
+{
+    next_chunk = 0;
+    for (int t = 0; t < nthreads; t++)
+        worker_claimed[t] = 0;
+    if (parallel && nthreads > 1)
+        run_on_all(task);
+    else
+        (this->*task)(0);
+}
+
+/**
+ * @brief Marks cell visited, reached from the cell in direction
+ * directions[back], unless another thread got there first.
+ *
+ * @return `true` if this thread claimed the cell.
+ */
+bool ParallelBFSSolver::claim(uint32_t cell, int back)
+{
+    uint64_t bit = 1ULL << (cell & 63);
+    size_t word = cell >> 6;
+
+    /* Most neighbors are already visited (one of them is the cell this
+       one was reached from), so look before paying for the atomic or. */
+    if (visited[word].load(std::memory_order_relaxed) & bit)
+        return false;
+    if (visited[word].fetch_or(bit, std::memory_order_relaxed) & bit)
+        return false;
+    if (back & 1)
+        from_low[word].fetch_or(bit, std::memory_order_relaxed);
+    if (back & 2)
+        from_high[word].fetch_or(bit, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief A top-down step for one thread: claims the unvisited neighbors
+ * of its chunks of the frontier, into its part of the next frontier.
+ */
+void ParallelBFSSolver::top_down(int worker)
+{
+    std::vector<uint32_t> &mine = next[worker];
+    size_t n = frontier.size();
+
+    for (size_t begin = next_chunk.fetch_add(TOP_DOWN_CHUNK); begin < n;
+        begin = next_chunk.fetch_add(TOP_DOWN_CHUNK))
+    {
+        size_t stop = std::min(begin + TOP_DOWN_CHUNK, n);
+        for (size_t i = begin; i < stop; i++)
+        {
+            uint32_t cell = frontier[i];
+            int moves = maze->get_possible_moves(cell % width, cell / width);
+            for (int d = 0; d < 4; d++)
+            {
+                uint32_t neighbor = cell + steps[d];
+                if ((moves & directions[d]) && claim(neighbor, d ^ 1))
+                    mine.push_back(neighbor);
+            }
+        }
+    }
+    worker_claimed[worker] = mine.size();
+}
+
+/**
+ * @brief A bottom-up step for one thread: for each unvisited cell in its
+ * chunks of the visited bitmap, looks for a neighbor in the frontier.
+ * Only this thread writes those words in this step, so it needs no
+ * atomic read-modify-writes.
+ */
+void ParallelBFSSolver::bottom_up(int worker)
+{
+    uint64_t cells = (uint64_t) width * height;
+    long claimed = 0;
+
+    for (size_t begin = next_chunk.fetch_add(BOTTOM_UP_CHUNK); begin < nwords;
+        begin = next_chunk.fetch_add(BOTTOM_UP_CHUNK))
+    {
+        size_t stop = std::min(begin + BOTTOM_UP_CHUNK, nwords);
+        for (size_t w = begin; w < stop; w++)
+        {
+            uint64_t seen = visited[w].load(std::memory_order_relaxed);
+            uint64_t todo = ~seen, fresh = 0, low = 0, high = 0;
+            if (w == nwords - 1 && cells % 64 != 0)
+                todo &= (1ULL << (cells % 64)) - 1;
+
+            while (todo != 0)
+            {
+                int b = __builtin_ctzll(todo);
+                uint64_t bit = 1ULL << b;
+                uint32_t cell = (uint32_t) (w * 64 + b);
+                int moves = maze->get_possible_moves(cell % width, cell / width);
+                todo &= todo - 1;
+
+                for (int d = 0; d < 4; d++)
+                {
+                    uint32_t neighbor = cell + steps[d];
+                    if ((moves & directions[d])
+                        && (frontier_bits[neighbor >> 6].load(std::memory_order_relaxed)
+                            >> (neighbor & 63) & 1))
+                    {
+                        /* The way back is towards the neighbor. */
+                        fresh |= bit;
+                        if (d & 1)
+                            low |= bit;
+                        if (d & 2)
+                            high |= bit;
+                        claimed++;
+                        break;
+                    }
+                }
+            }
+
+            next_bits[w].store(fresh, std::memory_order_relaxed);
+            if (fresh != 0)
+            {
+                visited[w].store(seen | fresh, std::memory_order_relaxed);
+                from_low[w].store(from_low[w].load(std::memory_order_relaxed) | low,
+                    std::memory_order_relaxed);
+                from_high[w].store(from_high[w].load(std::memory_order_relaxed) | high,
+                    std::memory_order_relaxed);
+            }
+        }
+    }
+    worker_claimed[worker] = claimed;
+}
+
+/**
+ * @brief Solve the maze given by `maze`.
+ *
+ * @param[in] maze MazeGrid object that stores the maze to be
+ * solved.
+ */
+void ParallelBFSSolver::solve(MazeGrid *maze)
+{
+    this->maze = maze;
+    width = maze->get_width();
+    height = maze->get_height();
+    long cells = (long) width * height;
+    nwords = (cells + 63) / 64;
+    end = (uint32_t) (cells - 1);
+    for (int d = 0; d < 4; d++)
+        steps[d] = dy[d] * (long) width + dx[d];
+
+    /* New bitmaps start out all zeros. */
+    std::vector<Word>(nwords).swap(visited);
+    std::vector<Word>(nwords).swap(from_low);
+    std::vector<Word>(nwords).swap(from_high);
+    std::vector<Word>(nwords).swap(frontier_bits);
+    std::vector<Word>(nwords).swap(next_bits);
+
+    uint32_t start = MAZE_START_Y * width + MAZE_START_X;
+    claim(start, 0);
+    frontier.assign(1, start);
+    expanded = 0;
+
+    long unvisited = cells - 1, frontier_size = 1, last_size = 0;
+    bool top_down_step = true;
+    found = (start == end);
+
+    while (!found && frontier_size > 0)
+    {
+        if (top_down_step && frontier_size > unvisited / PARALLEL_BFS_ALPHA)
+        {
+            /* The frontier is a large part of what is left, so look for
+               the next level from the cells not yet visited. */
+            for (size_t w = 0; w < nwords; w++)
+                frontier_bits[w].store(0, std::memory_order_relaxed);
+            for (size_t i = 0; i < frontier.size(); i++)
+                frontier_bits[frontier[i] >> 6].fetch_or(1ULL << (frontier[i] & 63),
+                    std::memory_order_relaxed);
+            top_down_step = false;
+        }
+        else if (!top_down_step && frontier_size < last_size
+            && frontier_size < cells / PARALLEL_BFS_BETA)
+        {
+            /* The frontier is shrinking and small again. */
+            frontier.clear();
+            for (size_t w = 0; w < nwords; w++)
+            {
+                uint64_t bits = frontier_bits[w].load(std::memory_order_relaxed);
+                while (bits != 0)
+                {
+                    frontier.push_back((uint32_t) (w * 64 + __builtin_ctzll(bits)));
+                    bits &= bits - 1;
+                }
+            }
+            top_down_step = true;
+        }
+
+        /* The cells expanded are this level's, whichever way the step
+           goes; a bottom-up step scans the unvisited cells, but does not
+           expand them. */
+        expanded += frontier_size;
+        if (top_down_step)
+        {
+            run(&ParallelBFSSolver::top_down,
+                frontier_size > PARALLEL_BFS_SERIAL_MAX);
+            frontier.clear();
+            for (int t = 0; t < nthreads; t++)
+            {
+                frontier.insert(frontier.end(), next[t].begin(), next[t].end());
+                next[t].clear();
+            }
+        }
+        else
+        {
+            run(&ParallelBFSSolver::bottom_up, true);
+            frontier_bits.swap(next_bits);
+        }
+
+        last_size = frontier_size;
+        frontier_size = 0;
+        for (int t = 0; t < nthreads; t++)
+            frontier_size += worker_claimed[t];
+        unvisited -= frontier_size;
+        found = visited[end >> 6].load(std::memory_order_relaxed) >> (end & 63) & 1;
+    }
+
+#ifndef HEADLESS
+    if (found)
+        printf("COMPLETED THE MAZE!!!\n");
+#endif
+}
+
+/**
+ * @brief Retrieves the path through the maze.
+ *
+ * @return Vector storing the path through the maze, from the end back to
+ * the start, or nothing if there is none.
+ */
+vector<Coordinate> ParallelBFSSolver::get_path()
+{
+    vector<Coordinate> list;
+
+    if (!found)
+        return list;
+
+    Coordinate c(width - 1, height - 1);
+    list.push_back(c);
+    while (c.x != MAZE_START_X || c.y != MAZE_START_Y)
+    {
+        uint32_t cell = c.y * width + c.x;
+        uint64_t bit = 1ULL << (cell & 63);
+        int back = ((from_low[cell >> 6].load() & bit) != 0)
+            | (((from_high[cell >> 6].load() & bit) != 0) << 1);
+        c = Coordinate(c.x + dx[back], c.y + dy[back]);
+        list.push_back(c);
+    }
+    return list;
+}
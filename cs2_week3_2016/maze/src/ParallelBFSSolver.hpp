@@ -0,0 +1,124 @@
+/**
+ * @file ParallelBFSSolver.hpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Definitions for parallel breadth-first maze solver class.
+ */
+
+#ifndef __PARALLELBFSSOLVER_H__
+#define __PARALLELBFSSOLVER_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "MazeSolverBase.hpp"
+
+/* A level with fewer cells than this is expanded on the calling thread,
+   since waking the other threads would take longer. */
+#ifndef PARALLEL_BFS_SERIAL_MAX
+#define PARALLEL_BFS_SERIAL_MAX     (4096)
+#endif
+
+/* Switch to bottom-up steps when the frontier has more than 1 /
+   PARALLEL_BFS_ALPHA of the cells not yet visited, and back to top-down
+   ones when it has fewer than 1 / PARALLEL_BFS_BETA of all the cells. */
+#ifndef PARALLEL_BFS_ALPHA
+#define PARALLEL_BFS_ALPHA          (14)
+#endif
+#ifndef PARALLEL_BFS_BETA
+#define PARALLEL_BFS_BETA           (24)
+#endif
+
+/**
+ * @brief Encapsulates a parallel, level-synchronous breadth-first maze
+ * solver.
+ *
+ * The solver finds each level of the search (the cells one step further
+ * from the start than the last level) from the last one, sharing the
+ * work between the threads of a pool that lives as long as the solver.
+ * A level is found in one of two ways:
+ * - Top-down: the threads take the cells of the frontier, a flat array,
+ *   in chunks, and claim their unvisited neighbors by setting their bits
+ *   in the visited bitmap with an atomic or. Each thread collects the
+ *   cells it claimed in its own array, and those are joined into the
+ *   next frontier.
+ * - Bottom-up: the threads take the unvisited cells, 64 at a time (one
+ *   word of the visited bitmap, which only that thread writes), and look
+ *   for a neighbor in the frontier, which is kept as a bitmap for this.
+ * Top-down costs in proportion to the frontier, and bottom-up in
+ * proportion to the cells not yet visited, so the solver goes bottom-up
+ * while the frontier is a large part of what is left; in an open maze
+ * that saves most of the work of the middle levels. In a perfect maze,
+ * the frontier stays small, and most levels are done on one thread.
+ *
+ * The bitmaps have one bit per cell, numbered y * width + x, and, like
+ * the breadth-first solver, the direction each cell was reached from is
+ * kept in two of them. The solver does not animate.
+ */
+class ParallelBFSSolver : public MazeSolverBase
+{
+public:
+    ParallelBFSSolver(int nthreads = 0);
+    ~ParallelBFSSolver();
+
+    void solve(MazeGrid *maze);
+    vector<Coordinate> get_path();
+
+    /**
+     * @brief The number of threads that solve() uses, counting the one
+     * that calls it.
+     */
+    int threads() const { return nthreads; }
+
+private:
+    typedef std::atomic<uint64_t> Word;
+
+    const MazeGrid *maze;
+    int width, height;
+    uint32_t end;
+    bool found;
+
+    /* Bitmaps: visited cells, the directions back (bit 0 and bit 1 of
+       the index into {N, S, E, W}), and, for bottom-up steps, the
+       frontier and the next one. */
+    std::vector<Word> visited, from_low, from_high;
+    std::vector<Word> frontier_bits, next_bits;
+    /* The frontier for top-down steps, and each thread's part of the
+       next one. */
+    std::vector<uint32_t> frontier;
+    std::vector<std::vector<uint32_t> > next;
+    /* Per thread: cells claimed in the last step. */
+    std::vector<long> worker_claimed;
+    std::atomic<size_t> next_chunk;
+    size_t nwords;
+    /* How far a step in each direction moves a cell's number. */
+    long steps[4];
+
+    // The pool: workers 1 to nthreads - 1 wait for each new generation,
+    // run the task, and count themselves out; the caller is worker 0
+    int nthreads;
+    std::vector<std::thread> workers;
+    std::mutex lock;
+    std::condition_variable wake, done;
+    unsigned long generation;
+    int running;
+    bool stopping;
+    void (ParallelBFSSolver::*task)(int worker);
+
+    void run(void (ParallelBFSSolver::*task)(int worker), bool parallel);
+    void run_on_all(void (ParallelBFSSolver::*task)(int worker));
+    void worker_loop(int worker);
+    bool claim(uint32_t cell, int back);
+    void top_down(int worker);
+    void bottom_up(int worker);
+
+    // The pool belongs to one solver, so solvers are not copied
+    ParallelBFSSolver(const ParallelBFSSolver &);
+    ParallelBFSSolver &operator=(const ParallelBFSSolver &);
+};
+
+#endif
@@ -47,13 +47,24 @@
 
 #define NUM_DIRECTIONS  (4)
 
+/**
+ * @brief The directions, in the order of the index kept in back_low and
+ * back_high.
+ */
+static const int directions[NUM_DIRECTIONS] = {N, S, E, W};
+
 /**
  * @brief Initializes the maze generator.
+ *
+ * @param[in] width Width of the mazes to generate, in cells.
+ * @param[in] height Height of the mazes to generate, in cells.
+ * @param[in] seed Seed for the random choices; the same seed gives the
+ * same mazes.
  */
-RecursiveBacktracker::RecursiveBacktracker()
+RecursiveBacktracker::RecursiveBacktracker(int width, int height,
+    uint64_t seed) : random(seed)
 {
-    maze = new MazeGrid();
-    srand(time(0));
+    maze = new MazeGrid(width, height);
 }
 
 /**
@@ -71,20 +82,22 @@ void RecursiveBacktracker::ascii_print()
 {
     int x, y;
 
-    for (x = 0; x < WIDTH * 2; x++)
+    for (x = 0; x < maze->width * 2; x++)
     {
         printf("_");
     }
 
     printf("\n");
 
-    for (y = 0; y < HEIGHT; y++)
+    for (y = 0; y < maze->height; y++)
     {
         printf("|");
 
-        for (x = 0; x < WIDTH; x++)
+        for (x = 0; x < maze->width; x++)
         {
-            if ((maze->grid[x][y] & S) != 0)
+            int moves = maze->get_possible_moves(x, y);
+
+            if ((moves & S) != 0)
             {
                 printf(" ");
             }
@@ -93,10 +106,10 @@ void RecursiveBacktracker::ascii_print()
                 printf("_");
             }
 
-            if ((maze->grid[x][y] & E) != 0)
+            if ((moves & E) != 0)
             {
-                if (((maze->grid[x][y] |
-                    maze->grid[x+1][y]) & S) != 0)
+                if (((moves |
+                    maze->get_possible_moves(x + 1, y)) & S) != 0)
                 {
                     printf(" ");
                 }
@@ -116,30 +129,78 @@ void RecursiveBacktracker::ascii_print()
 }
 
 /**
- * @brief Recursive function to generate a maze.
+ * @brief Generates a maze, starting from a given cell.
+ *
+ * From the current cell, the generator carves a passage to a random
+ * neighbor it has not reached yet and moves there; when there is no such
+ * neighbor, it backs up to the cell it came from. That is what the
+ * recursive version did, with the call stack remembering the way back;
+ * here each cell remembers the direction it was reached from instead, in
+ * two bits, so backing up needs no stack at all. Picking the next
+ * neighbor at random among those left gives the same mazes, in
+ * distribution, as shuffling the directions once per cell.
  *
  * @param[in] cx Starting x-coordinate.
  * @param[in] cy Starting y-coordinate.
  */
 void RecursiveBacktracker::carve_passages_from(int cx, int cy)
 {
-    int i, nx, ny, directions[] = {N, S, E, W};
-    shuffle_array(directions, NUM_DIRECTIONS);
+    int width = maze->width, height = maze->height;
+    int x = cx, y = cy;
 
-    for (i = 0; i < NUM_DIRECTIONS; i++)
+    visited.resize(width, height);
+    back_low.resize(width, height);
+    back_high.resize(width, height);
+    visited.set(x, y);
+
+    while (true)
     {
-        nx = cx + get_dx(directions[i]);
-        ny = cy + get_dy(directions[i]);
+        int i, count = 0, options[NUM_DIRECTIONS];
 
-        if ((nx >= 0 && nx < WIDTH) && (ny >= 0 && ny < HEIGHT)
-            && maze->grid[nx][ny] == 0)
+        for (i = 0; i < NUM_DIRECTIONS; i++)
         {
-            maze->grid[cx][cy] |= directions[i];
-            maze->grid[nx][ny] |= get_opposite(directions[i]);
+            int nx = x + get_dx(directions[i]);
+            int ny = y + get_dy(directions[i]);
+
+            if ((nx >= 0 && nx < width) && (ny >= 0 && ny < height)
+                && !visited.get(nx, ny))
+            {
+                options[count++] = i;
+            }
+        }
 
-            carve_passages_from(nx, ny);
+        if (count > 0)
+        {
+            /* Carve forward; the way back is the opposite direction,
+               whose index is i ^ 1. */
+            i = options[random.below(count)];
+            maze->carve(x, y, directions[i]);
+            x += get_dx(directions[i]);
+            y += get_dy(directions[i]);
+            visited.set(x, y);
+            if ((i ^ 1) & 1)
+                back_low.set(x, y);
+            if ((i ^ 1) & 2)
+                back_high.set(x, y);
+        }
+        else if (x == cx && y == cy)
+        {
+            /* Back at the start with nowhere left to go. */
+            break;
+        }
+        else
+        {
+            /* Dead end; back up. */
+            i = back_low.get(x, y) | (back_high.get(x, y) << 1);
+            x += get_dx(directions[i]);
+            y += get_dy(directions[i]);
         }
     }
+
+    /* The bitmaps are only needed while carving. */
+    visited.resize(0, 0);
+    back_low.resize(0, 0);
+    back_high.resize(0, 0);
 }
 
 /**
@@ -209,51 +270,3 @@ int RecursiveBacktracker::get_dy(int d)
             return 0;
     }
 }
-
-/**
- * @brief Returns an integer correspoinding to the direction that
- * is the opposite of the input parameter.
- *
- * @param[in] d A direction in {N, S, E, W}
- *
- * @return The direction opposite `d`.
- */
-int RecursiveBacktracker::get_opposite(int d)
-{
-    switch (d)
-    {
-        case N:
-            return S;
-
-        case E:
-            return W;
-
-        case S:
-            return N;
-
-        case W:
-            return E;
-    }
-
-    return 0;
-}
-
-/**
- * @brief Randomly shuffles the input array.
- *
- * @param[in] array Input array of integers.
- * @param[in] size Length of `array`.
- */
-void RecursiveBacktracker::shuffle_array(int *array, int size)
-{
-    int temp, randnum, last;
-
-    for (last = size; last > 1; last--)
-    {
-        randnum = rand() % last;
-        temp = array[randnum];
-
-        array[randnum] = array[last - 1];
-        array[last - 1] = temp;
-    }
-}
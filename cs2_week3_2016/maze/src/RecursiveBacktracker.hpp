@@ -50,6 +50,8 @@
 #include <cstdio>
 #include <ctime>
 #include "MazeGrid.hpp"
+#include "MazeGeneratorBase.hpp"
+#include "MazeRandom.hpp"
 #include "common.hpp"
 
 using namespace std;
@@ -57,11 +59,16 @@ using namespace std;
 /**
  * @brief Encapsulates a maze generator that uses the
  * recursive backtracker algorithm.
+ *
+ * The algorithm is run with a loop rather than recursion, since the
+ * recursion goes as deep as the longest path it carves, which for a
+ * large maze is far more than the call stack can hold.
  */
-class RecursiveBacktracker
+class RecursiveBacktracker : public MazeGeneratorBase
 {
 public:
-    RecursiveBacktracker();
+    RecursiveBacktracker(int width = WIDTH, int height = HEIGHT,
+        uint64_t seed = time(NULL));
     ~RecursiveBacktracker();
 
     void create_maze();
@@ -72,12 +79,15 @@ protected:
 
 private:
     MazeGrid *maze;
+    MazeRandom random;
+    /* Cells the generator has reached, and for each one the direction
+       back to the cell it was reached from, as an index into
+       {N, S, E, W}: bit 0 in back_low, bit 1 in back_high. */
+    CellBitmap visited, back_low, back_high;
 
     void carve_passages_from(int cx, int cy);
     int get_dx(int d);
     int get_dy(int d);
-    int get_opposite(int d);
-    void shuffle_array(int *array, int size);
 };
 
 #endif
@@ -0,0 +1,363 @@
+/**
+ * @file RingQueue.hpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Queues that keep their items in a ring buffer: one for a single
+ * thread, a lock-free one for one producer and one consumer, and a
+ * bounded one for any number of producers and consumers.
+ */
+
+#ifndef __RINGQUEUE_H__
+#define __RINGQUEUE_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <vector>
+
+/**
+ * @brief Size of a cache line; the indices the producers and consumers
+ * of the threaded queues write are kept this far apart, so that they do
+ * not keep taking the same line away from each other.
+ */
+#ifndef RING_CACHE_LINE
+#define RING_CACHE_LINE (64)
+#endif
+
+/**
+ * @brief Returns the smallest power of two that is at least n (and at
+ * least 2).
+ */
+inline size_t ring_capacity(size_t n)
+{
+    size_t capacity = 2;
+    while (capacity < n)
+    {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+/**
+ * @brief A FIFO queue for one thread, kept in a ring buffer that doubles
+ * in size when it fills up.
+ *
+ * The ring's size is a power of two, so an index wraps around with a
+ * mask rather than a division, and after the ring has grown to the
+ * queue's largest size, pushing and popping never allocate.
+ */
+template <class T>
+class RingQueue
+{
+public:
+    /**
+     * @brief Makes an empty queue with room for capacity items (rounded
+     * up to a power of two) before it has to grow.
+     */
+    explicit RingQueue(size_t capacity = 16)
+        : items(ring_capacity(capacity)), head(0), tail(0)
+    {
+        mask = items.size() - 1;
+    }
+
+    /**
+     * @brief Adds item to the back of the queue.
+     */
+    void push(const T &item)
+    {
+        if (tail - head == items.size())
+        {
+            grow();
+        }
+        items[tail & mask] = item;
+        tail++;
+    }
+
+    /**
+     * @brief Removes the item at the front of the queue into item.
+     *
+     * @return false, leaving item alone, if the queue is empty.
+     */
+    bool pop(T &item)
+    {
+        if (head == tail)
+        {
+            return false;
+        }
+        // Reset the slot so that it does not hold on to what item refers to
+        item = items[head & mask];
+        items[head & mask] = T();
+        head++;
+        return true;
+    }
+
+    /**
+     * @brief The item at the front of the queue, which must not be empty.
+     */
+    T &front()
+    {
+        return items[head & mask];
+    }
+
+    /**
+     * @brief Checks if the queue is empty.
+     */
+    bool empty() const
+    {
+        return head == tail;
+    }
+
+    /**
+     * @brief Number of items in the queue.
+     */
+    size_t size() const
+    {
+        return tail - head;
+    }
+
+private:
+    std::vector<T> items;
+    size_t mask;
+    // Items are popped from head and pushed at tail; both only increase,
+    // and tail - head is the number of items
+    size_t head, tail;
+
+    /**
+     * @brief Doubles the ring, moving the items to the start of the new one.
+     */
+    void grow()
+    {
+        std::vector<T> bigger(2 * items.size());
+        for (size_t i = head; i != tail; i++)
+        {
+            bigger[i - head] = items[i & mask];
+        }
+        items.swap(bigger);
+        mask = items.size() - 1;
+        tail -= head;
+        head = 0;
+    }
+};
+
+/**
+ * @brief A bounded, lock-free FIFO queue for exactly one producer thread
+ * and one consumer thread.
+ *
+ * The producer only writes tail and the consumer only writes head, so
+ * neither needs a compare-and-swap: each publishes its index with a
+ * release store once the slot is written (or read), and reads the
+ * other's with an acquire load. Each also keeps the last value it read
+ * of the other's index, and only loads it again when that copy says the
+ * queue is full (or empty), which keeps the two cache lines from moving
+ * back and forth between the cores on every item.
+ */
+template <class T>
+class SpscRingQueue
+{
+public:
+    /**
+     * @brief Makes an empty queue that holds up to capacity items
+     * (rounded up to a power of two).
+     */
+    explicit SpscRingQueue(size_t capacity)
+        : items(ring_capacity(capacity)), head(0), tail(0)
+    {
+        mask = items.size() - 1;
+        cached_head = 0;
+        cached_tail = 0;
+    }
+
+    /**
+     * @brief Adds item to the back of the queue; producer only.
+     *
+     * @return false if the queue is full.
+     */
+    bool try_push(const T &item)
+    {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cached_head == items.size())
+        {
+            cached_head = head.load(std::memory_order_acquire);
+            if (t - cached_head == items.size())
+            {
+                return false;
+            }
+        }
+        items[t & mask] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the item at the front of the queue into item;
+     * consumer only.
+     *
+     * @return false, leaving item alone, if the queue is empty.
+     */
+    bool try_pop(T &item)
+    {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == cached_tail)
+        {
+            cached_tail = tail.load(std::memory_order_acquire);
+            if (h == cached_tail)
+            {
+                return false;
+            }
+        }
+        item = items[h & mask];
+        items[h & mask] = T();
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::vector<T> items;
+    size_t mask;
+    // The consumer's index, and its copy of the producer's
+    alignas(RING_CACHE_LINE) std::atomic<size_t> head;
+    size_t cached_tail;
+    // The producer's index, and its copy of the consumer's
+    alignas(RING_CACHE_LINE) std::atomic<size_t> tail;
+    size_t cached_head;
+    char padding[RING_CACHE_LINE - sizeof(size_t) - sizeof(std::atomic<size_t>)];
+
+    // The queue is shared by reference, so it is not copied
+    SpscRingQueue(const SpscRingQueue &);
+    SpscRingQueue &operator=(const SpscRingQueue &);
+};
+
+/**
+ * @brief A bounded FIFO queue for any number of producer and consumer
+ * threads (Dmitry Vyukov's bounded MPMC queue).
+ *
+ * Every slot has a sequence number that says whose turn it is. A slot
+ * is ready to be pushed at position p when its number is p, and ready to
+ * be popped at p once the push has set it to p + 1; the pop then sets it
+ * to p + capacity, ready for the push one lap later. A producer (or
+ * consumer) claims a position with one compare-and-swap on the shared
+ * tail (or head), then writes the slot and its number without any lock,
+ * so threads only contend on the index, never on a lock, and a thread
+ * that is preempted holds up only the one slot it claimed.
+ */
+template <class T>
+class MpmcRingQueue
+{
+public:
+    /**
+     * @brief Makes an empty queue that holds up to capacity items
+     * (rounded up to a power of two).
+     */
+    explicit MpmcRingQueue(size_t capacity)
+    {
+        size_t n = ring_capacity(capacity);
+        mask = n - 1;
+        cells = new Cell[n];
+        for (size_t i = 0; i < n; i++)
+        {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+    }
+
+    ~MpmcRingQueue()
+    {
+        delete[] cells;
+    }
+
+    /**
+     * @brief Adds item to the back of the queue.
+     *
+     * @return false if the queue is full.
+     */
+    bool try_push(const T &item)
+    {
+        Cell *cell;
+        size_t pos = tail.load(std::memory_order_relaxed);
+        while (true)
+        {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t turn = (intptr_t) sequence - (intptr_t) pos;
+            if (turn == 0)
+            {
+                if (tail.compare_exchange_weak(pos, pos + 1,
+                    std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (turn < 0)
+            {
+                // The slot has not been popped since the last lap
+                return false;
+            }
+            else
+            {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->item = item;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the item at the front of the queue into item.
+     *
+     * @return false, leaving item alone, if the queue is empty.
+     */
+    bool try_pop(T &item)
+    {
+        Cell *cell;
+        size_t pos = head.load(std::memory_order_relaxed);
+        while (true)
+        {
+            cell = &cells[pos & mask];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t turn = (intptr_t) sequence - (intptr_t) (pos + 1);
+            if (turn == 0)
+            {
+                if (head.compare_exchange_weak(pos, pos + 1,
+                    std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (turn < 0)
+            {
+                // The slot has not been pushed yet
+                return false;
+            }
+            else
+            {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+        item = cell->item;
+        cell->item = T();
+        cell->sequence.store(pos + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T item;
+    };
+    Cell *cells;
+    size_t mask;
+    alignas(RING_CACHE_LINE) std::atomic<size_t> head;
+    alignas(RING_CACHE_LINE) std::atomic<size_t> tail;
+    char padding[RING_CACHE_LINE - sizeof(std::atomic<size_t>)];
+
+    // The queue is shared by reference, so it is not copied
+    MpmcRingQueue(const MpmcRingQueue &);
+    MpmcRingQueue &operator=(const MpmcRingQueue &);
+};
+
+#endif
@@ -0,0 +1,129 @@
+/**
+ * @file WilsonGenerator.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Functions for maze generator that uses Wilson's algorithm.
+ */
+#include "WilsonGenerator.hpp"
+
+/**
+ * @brief The directions, in the order of the index kept in exit_low and
+ * exit_high, and the steps they take.
+ */
+static const int directions[] = {N, S, E, W};
+static const int dx[] = {0, 0, 1, -1};
+static const int dy[] = {-1, 1, 0, 0};
+
+/**
+ * @brief Initializes the maze generator.
+ *
+ * @param[in] width Width of the mazes to generate, in cells.
+ * @param[in] height Height of the mazes to generate, in cells.
+ * @param[in] seed Seed for the random choices; the same seed gives the
+ * same mazes.
+ */
+WilsonGenerator::WilsonGenerator(int width, int height, uint64_t seed)
+    : random(seed)
+{
+    maze = new MazeGrid(width, height);
+}
+
+/**
+ * @brief Deinitializes the maze generator.
+ */
+WilsonGenerator::~WilsonGenerator()
+{
+    delete maze;
+}
+
+/**
+ * @brief Returns the index of a random direction from (x, y) that stays
+ * inside the maze.
+ */
+int WilsonGenerator::random_step(int x, int y)
+{
+    while (true)
+    {
+        int i = random.below(4);
+        int nx = x + dx[i], ny = y + dy[i];
+
+        if (nx >= 0 && nx < maze->width && ny >= 0 && ny < maze->height)
+            return i;
+    }
+}
+
+/**
+ * @brief Creates a maze, replacing the last one.
+ */
+void WilsonGenerator::create_maze()
+{
+    int width = maze->width, height = maze->height;
+    int x, y, cx, cy, i;
+
+    maze->init();
+    in_maze.resize(width, height);
+    exit_low.resize(width, height);
+    exit_high.resize(width, height);
+
+    /* The maze starts out as one random cell. */
+    in_maze.set(random.below(width), random.below(height));
+
+    for (y = 0; y < height; y++)
+    {
+        for (x = 0; x < width; x++)
+        {
+            if (in_maze.get(x, y))
+                continue;
+
+            /* Walk at random until the walk reaches the maze. A cell the
+               walk comes back to gets a new exit, which erases the loop
+               the walk made since it was last there. */
+            cx = x;
+            cy = y;
+            while (!in_maze.get(cx, cy))
+            {
+                i = random_step(cx, cy);
+                if (i & 1)
+                    exit_low.set(cx, cy);
+                else
+                    exit_low.reset(cx, cy);
+                if (i & 2)
+                    exit_high.set(cx, cy);
+                else
+                    exit_high.reset(cx, cy);
+                cx += dx[i];
+                cy += dy[i];
+            }
+
+            /* Follow the exits from the start of the walk, adding each
+               cell to the maze. */
+            cx = x;
+            cy = y;
+            while (!in_maze.get(cx, cy))
+            {
+                i = exit_low.get(cx, cy) | (exit_high.get(cx, cy) << 1);
+                in_maze.set(cx, cy);
+                maze->carve(cx, cy, directions[i]);
+                cx += dx[i];
+                cy += dy[i];
+            }
+        }
+    }
+
+    /* The bitmaps are only needed while generating. */
+    in_maze.resize(0, 0);
+    exit_low.resize(0, 0);
+    exit_high.resize(0, 0);
+}
+
+/**
+ * @brief Returns the generated maze.
+ *
+ * @return Maze as a MazeGrid object.
+ */
+MazeGrid *WilsonGenerator::get_maze()
+{
+    return maze;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file WilsonGenerator.hpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Definitions for maze generator that uses Wilson's algorithm.
+ */
+
+#ifndef __WILSONGENERATOR_H__
+#define __WILSONGENERATOR_H__
+
+#include <ctime>
+#include "MazeGrid.hpp"
+#include "MazeGeneratorBase.hpp"
+#include "MazeRandom.hpp"
+
+/**
+ * @brief Encapsulates a maze generator that uses Wilson's algorithm.
+ *
+ * Wilson's algorithm makes every possible maze of the given size equally
+ * likely (a uniform spanning tree), unlike the backtracker, whose mazes
+ * have long, winding passages and few dead ends. Starting from each cell
+ * not yet in the maze, it takes a random walk until it reaches the maze,
+ * and then adds the walk's path to the maze with its loops erased. The
+ * first walks are long, so it is the slowest of the generators.
+ */
+class WilsonGenerator : public MazeGeneratorBase
+{
+public:
+    WilsonGenerator(int width = WIDTH, int height = HEIGHT,
+        uint64_t seed = time(NULL));
+    ~WilsonGenerator();
+
+    void create_maze();
+    MazeGrid *get_maze();
+
+private:
+    MazeGrid *maze;
+    MazeRandom random;
+    /* Cells already in the maze, and for each cell on the current walk
+       the direction the walk last left it by, as an index into
+       {N, S, E, W}: bit 0 in exit_low, bit 1 in exit_high. */
+    CellBitmap in_maze, exit_low, exit_high;
+
+    int random_step(int x, int y);
+};
+
+#endif
@@ -46,10 +46,16 @@
 #ifndef __STRUCTS_H__
 #define __STRUCTS_H__
 
+/* The queue and stack redraw the maze, slowly, on every operation, so
+   that the solvers can be watched; not in the testsuite (-DTESTSUITE) or
+   the benchmarks (-DHEADLESS), which build without SDL. */
+#if !defined(TESTSUITE) && !defined(HEADLESS)
+#define MAZE_ANIMATE
+#endif
+
+/* The solvers start here, and end at the opposite corner of the maze. */
 #define MAZE_START_X    (0)
 #define MAZE_START_Y    (0)
-#define MAZE_END_X      (WIDTH - 1)
-#define MAZE_END_Y      (HEIGHT - 1)
 
 /**
  * @brief Encapsulates a Cartesian (x, y) coordinate.
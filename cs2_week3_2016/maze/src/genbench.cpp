@@ -0,0 +1,295 @@
+/**
+ * @file genbench.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Benchmarks how fast the maze generators make mazes.
+ *
+ * Makes mazes of the given size with each generator, and prints one CSV
+ * row per generator with the median time and the rate in cells per
+ * second. The row "eller-rows" is Eller's algorithm streaming a maze of
+ * the given width and -r rows, which is never held in memory. -c checks
+ * that every maze is perfect: it has one passage fewer than it has
+ * cells, and every cell can be reached from the start, so there is
+ * exactly one path between any two cells.
+ *
+ * It does not use SDL, so it needs neither SDL nor a display.
+ */
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "CellBitmap.hpp"
+#include "RingQueue.hpp"
+#include "RecursiveBacktracker.hpp"
+#include "WilsonGenerator.hpp"
+#include "EllerGenerator.hpp"
+#include "KruskalGenerator.hpp"
+
+using namespace std;
+
+const char *bench_usage_string =
+"Usage: genbench [-w WIDTH] [-h HEIGHT] [-t TRIALS] [-s SEED] [-g GENERATOR]\n\
+                [-r ROWS] [-c]\n\
+    Generates mazes and prints CSV to stdout.\n\
+    -w WIDTH     maze width, in cells (default: 1000)\n\
+    -h HEIGHT    maze height, in cells (default: 1000)\n\
+    -t TRIALS    trials per generator (default: 5)\n\
+    -s SEED      seed for the first trial; each trial adds 1 (default: 1)\n\
+    -g GENERATOR only run backtracker, wilson, eller, kruskal or eller-rows\n\
+    -r ROWS      rows of the streamed Eller maze (default: 10 * HEIGHT)\n\
+    -c           check that every maze is perfect\n";
+
+/**
+ * @brief Counts the passages of a streamed maze as its rows go by, and
+ * checks that none of them closes a loop.
+ *
+ * A union-find forest over the cells of the current row tracks which of
+ * them are already connected (by way of the rows above), so it needs
+ * memory proportional to the width only. A passage east between two
+ * cells of one set closes a loop. Passages south carry a set into the
+ * next row; the other cells of the next row start as sets of their own.
+ * A maze without loops is perfect if it also has one passage fewer than
+ * it has cells.
+ */
+class PassageCounter : public MazeRowSink
+{
+public:
+    PassageCounter() : passages(0), loop(false) { }
+
+    void add_row(long y, const vector<char> &east, const vector<char> &south)
+    {
+        uint32_t width = east.size();
+        if (parent.empty())
+        {
+            parent.resize(width);
+            roots.resize(width);
+            first.assign(width, width);
+            for (uint32_t x = 0; x < width; x++)
+                parent[x] = x;
+        }
+
+        for (uint32_t x = 0; x < width; x++)
+        {
+            passages += east[x] + south[x];
+            if (!east[x] || x + 1 == width)
+                continue;
+            uint32_t a = find(x), b = find(x + 1);
+            if (a == b)
+                loop = true;
+            else
+                parent[a] = b;
+        }
+
+        // The next row: below each set, its first cell with a passage
+        // south becomes the root of the others
+        for (uint32_t x = 0; x < width; x++)
+            roots[x] = find(x);
+        for (uint32_t x = 0; x < width; x++)
+        {
+            parent[x] = x;
+            if (!south[x])
+                continue;
+            if (first[roots[x]] == width)
+                first[roots[x]] = x;
+            else
+                parent[x] = first[roots[x]];
+        }
+        for (uint32_t x = 0; x < width; x++)
+            first[roots[x]] = width;
+    }
+
+    long long passages;
+    bool loop;
+
+private:
+    /* Each cell's parent in the forest over the current row. */
+    vector<uint32_t> parent;
+    /* Scratch: the root of each cell of the row just finished, and the
+       first cell below each root with a passage south. */
+    vector<uint32_t> roots, first;
+
+    uint32_t find(uint32_t x)
+    {
+        while (parent[x] != x)
+        {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+};
+
+/**
+ * @brief Returns true if maze is perfect: it has one passage fewer than
+ * it has cells, and a breadth-first search from the start reaches them
+ * all.
+ */
+bool is_perfect(const MazeGrid *maze)
+{
+    int width = maze->get_width(), height = maze->get_height();
+    long long passages = 0, reached = 1;
+    CellBitmap seen;
+    RingQueue<Coordinate> queue;
+    Coordinate c;
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int moves = maze->get_possible_moves(x, y);
+            passages += ((moves & E) != 0) + ((moves & S) != 0);
+        }
+    }
+    if (passages != (long long) width * height - 1)
+        return false;
+
+    seen.resize(width, height);
+    seen.set(MAZE_START_X, MAZE_START_Y);
+    queue.push(Coordinate(MAZE_START_X, MAZE_START_Y));
+    while (queue.pop(c))
+    {
+        int moves = maze->get_possible_moves(c.x, c.y);
+        const int dirs[] = {N, S, E, W};
+        const int dx[] = {0, 0, 1, -1}, dy[] = {-1, 1, 0, 0};
+
+        for (int i = 0; i < 4; i++)
+        {
+            int nx = c.x + dx[i], ny = c.y + dy[i];
+            if ((moves & dirs[i]) && !seen.get(nx, ny))
+            {
+                seen.set(nx, ny);
+                queue.push(Coordinate(nx, ny));
+                reached++;
+            }
+        }
+    }
+    return reached == (long long) width * height;
+}
+
+/**
+ * @brief Makes a width x height maze with generator type G from seed,
+ * and returns how long create_maze() took, in milliseconds. Sets ok to
+ * false if check is set and the maze is not perfect.
+ */
+template <class G>
+double generate(int width, int height, uint64_t seed, bool check, bool &ok)
+{
+    G generator(width, height, seed);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    generator.create_maze();
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    if (check && !is_perfect(generator.get_maze()))
+        ok = false;
+    return elapsed.count();
+}
+
+/**
+ * @brief Streams a width x rows maze with Eller's algorithm, and returns
+ * how long it took, in milliseconds. Sets ok to false if check is set
+ * and the maze has a loop or the wrong number of passages.
+ */
+double generate_rows(int width, long rows, uint64_t seed, bool check, bool &ok)
+{
+    EllerGenerator generator(width, 1, seed);
+    PassageCounter counter;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    generator.generate_rows(width, rows, &counter);
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    if (check && (counter.loop
+            || counter.passages != (long long) width * rows - 1))
+        ok = false;
+    return elapsed.count();
+}
+
+/**
+ * @brief One generator: its name, and the function that runs it.
+ */
+struct Generator
+{
+    const char *name;
+    double (*generate)(int width, int height, uint64_t seed, bool check,
+        bool &ok);
+};
+
+const Generator generators[] =
+{
+    { "backtracker", generate<RecursiveBacktracker> },
+    { "wilson",      generate<WilsonGenerator> },
+    { "eller",       generate<EllerGenerator> },
+    { "kruskal",     generate<KruskalGenerator> },
+};
+
+/**
+ * @brief Prints the median of ms as a CSV row.
+ */
+void report(const char *name, int width, long height, vector<double> &ms,
+    bool check, bool ok)
+{
+    sort(ms.begin(), ms.end());
+    double median = ms[ms.size() / 2];
+    printf("%s,%d,%ld,%lu,%.3f,%.2f,%s\n", name, width, height,
+        (unsigned long) ms.size(), median,
+        (double) width * height / median / 1e3,
+        check ? (ok ? "ok" : "FAILED") : "-");
+    fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+    int width = 1000, height = 1000, trials = 5;
+    long rows = -1;
+    uint64_t seed = 1;
+    const char *only = NULL;
+    bool check = false, all_ok = true;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *arg = argv[i];
+        if (i + 1 < argc && strcmp(arg, "-w") == 0) { width = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-h") == 0) { height = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-t") == 0) { trials = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-s") == 0) { seed = strtoull(argv[++i], NULL, 10); }
+        else if (i + 1 < argc && strcmp(arg, "-g") == 0) { only = argv[++i]; }
+        else if (i + 1 < argc && strcmp(arg, "-r") == 0) { rows = atol(argv[++i]); }
+        else if (strcmp(arg, "-c") == 0) { check = true; }
+        else
+        {
+            fprintf(stderr, "%s", bench_usage_string);
+            return 1;
+        }
+    }
+    if (trials < 1) trials = 1;
+    if (rows < 0) rows = 10L * height;
+    if (width < 1 || height < 1 || rows < 1 || (long long) width * height >= (1LL << 31))
+    {
+        fprintf(stderr, "%s", bench_usage_string);
+        return 1;
+    }
+
+    printf("generator,width,height,trials,median_ms,mcells_per_s,check\n");
+    for (unsigned int g = 0; g < sizeof(generators) / sizeof(generators[0]); g++)
+    {
+        if (only != NULL && strcmp(only, generators[g].name) != 0)
+            continue;
+        vector<double> ms;
+        bool ok = true;
+        for (int t = 0; t < trials; t++)
+            ms.push_back(generators[g].generate(width, height, seed + t, check, ok));
+        report(generators[g].name, width, height, ms, check, ok);
+        all_ok = all_ok && ok;
+    }
+    if (only == NULL || strcmp(only, "eller-rows") == 0)
+    {
+        vector<double> ms;
+        bool ok = true;
+        for (int t = 0; t < trials; t++)
+            ms.push_back(generate_rows(width, rows, seed + t, check, ok));
+        report("eller-rows", width, rows, ms, check, ok);
+        all_ok = all_ok && ok;
+    }
+    return all_ok ? 0 : 1;
+}
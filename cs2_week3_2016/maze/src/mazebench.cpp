@@ -0,0 +1,243 @@
+/**
+ * @file mazebench.cpp
+ * @author agent <<agent@local>>
+ * @version 1.0
+ * @date 2026
+ *
+ * @brief Benchmarks the maze solvers.
+ *
+ * Makes a maze of the given size with one of the generators, solves it
+ * with each solver, and prints one CSV row per solver with the median
+ * time, the number of cells it expanded and the length of the path it
+ * found, in cells. -b knocks down a fraction of the walls that are left,
+ * which makes an open maze, with loops and many paths through it. -c
+ * checks every path: it must run from the end of the maze to the start
+ * through open passages, and the solvers that find shortest paths must
+ * find paths of the same length.
+ *
+ * The parallel solver runs with 1, 2, 4, ... threads, up to -j, with a
+ * row for each, to show how it scales.
+ *
+ * Built with -DHEADLESS, so the queue and stack do not redraw the maze
+ * (or wait) on every operation, and it needs neither SDL nor a display.
+ */
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "MazeSolverBase.hpp"
+#include "BreadthFirstSolver.hpp"
+#include "DepthFirstSolver.hpp"
+#include "AStarSolver.hpp"
+#include "BidirectionalBFSSolver.hpp"
+#include "ParallelBFSSolver.hpp"
+#include "RecursiveBacktracker.hpp"
+#include "WilsonGenerator.hpp"
+#include "EllerGenerator.hpp"
+#include "KruskalGenerator.hpp"
+
+using namespace std;
+
+const char *bench_usage_string =
+"Usage: mazebench [-w WIDTH] [-h HEIGHT] [-t TRIALS] [-s SEED] [-g GENERATOR]\n\
+                 [-b FRACTION] [-v SOLVER] [-j THREADS] [-c]\n\
+    Solves a maze with each solver and prints CSV to stdout.\n\
+    -w WIDTH     maze width, in cells (default: 1000)\n\
+    -h HEIGHT    maze height, in cells (default: 1000)\n\
+    -t TRIALS    trials per solver (default: 5)\n\
+    -s SEED      seed for the maze (default: 1)\n\
+    -g GENERATOR backtracker, wilson, eller or kruskal (default: backtracker)\n\
+    -b FRACTION  knock down this fraction of the walls left (default: 0)\n\
+    -v SOLVER    only run this solver\n\
+    -j THREADS   most threads for the parallel solver, 0 for one per core\n\
+                 (default: 0)\n\
+    -c           check every path\n";
+
+/**
+ * @brief One solver: its name, a function that makes one with a number
+ * of threads, whether the paths it finds are the shortest, and whether
+ * it uses the threads.
+ */
+struct Solver
+{
+    const char *name;
+    MazeSolverBase *(*make)(int threads);
+    bool shortest;
+    bool parallel;
+};
+
+template <class SolverType>
+MazeSolverBase *make_solver(int threads)
+{
+    return new SolverType(NULL);
+}
+
+MazeSolverBase *make_parallel_solver(int threads)
+{
+    return new ParallelBFSSolver(threads);
+}
+
+const Solver solvers[] =
+{
+    { "bfs",   make_solver<BreadthFirstSolver>,     true,  false },
+    { "dfs",   make_solver<DepthFirstSolver>,       false, false },
+    { "astar", make_solver<AStarSolver>,            true,  false },
+    { "bibfs", make_solver<BidirectionalBFSSolver>, true,  false },
+    { "pbfs",  make_parallel_solver,                true,  true },
+};
+
+/**
+ * @brief Returns true if path runs from the end of maze to its start,
+ * one open passage at a time.
+ */
+bool is_valid_path(const MazeGrid *maze, const vector<Coordinate> &path)
+{
+    int width = maze->get_width(), height = maze->get_height();
+
+    if (path.empty())
+        return false;
+    if (path.front().x != width - 1 || path.front().y != height - 1)
+        return false;
+    if (path.back().x != MAZE_START_X || path.back().y != MAZE_START_Y)
+        return false;
+
+    for (size_t i = 0; i + 1 < path.size(); i++)
+    {
+        const Coordinate &a = path[i], &b = path[i + 1];
+        int moves = maze->get_possible_moves(a.x, a.y), d;
+
+        if (b.x == a.x && b.y == a.y - 1) d = N;
+        else if (b.x == a.x && b.y == a.y + 1) d = S;
+        else if (b.x == a.x + 1 && b.y == a.y) d = E;
+        else if (b.x == a.x - 1 && b.y == a.y) d = W;
+        else return false;
+
+        if (!(moves & d))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Makes a maze with the named generator, or returns NULL if there
+ * is no such generator.
+ */
+MazeGeneratorBase *make_generator(const char *name, int width, int height,
+    uint64_t seed)
+{
+    if (strcmp(name, "backtracker") == 0)
+        return new RecursiveBacktracker(width, height, seed);
+    if (strcmp(name, "wilson") == 0)
+        return new WilsonGenerator(width, height, seed);
+    if (strcmp(name, "eller") == 0)
+        return new EllerGenerator(width, height, seed);
+    if (strcmp(name, "kruskal") == 0)
+        return new KruskalGenerator(width, height, seed);
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    int width = 1000, height = 1000, trials = 5, max_threads = 0;
+    uint64_t seed = 1;
+    double braid = 0;
+    const char *generator_name = "backtracker", *only = NULL;
+    bool check = false, all_ok = true;
+    long path_length = -1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        char *arg = argv[i];
+        if (i + 1 < argc && strcmp(arg, "-w") == 0) { width = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-h") == 0) { height = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-t") == 0) { trials = atoi(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-s") == 0) { seed = strtoull(argv[++i], NULL, 10); }
+        else if (i + 1 < argc && strcmp(arg, "-g") == 0) { generator_name = argv[++i]; }
+        else if (i + 1 < argc && strcmp(arg, "-b") == 0) { braid = atof(argv[++i]); }
+        else if (i + 1 < argc && strcmp(arg, "-v") == 0) { only = argv[++i]; }
+        else if (i + 1 < argc && strcmp(arg, "-j") == 0) { max_threads = atoi(argv[++i]); }
+        else if (strcmp(arg, "-c") == 0) { check = true; }
+        else
+        {
+            fprintf(stderr, "%s", bench_usage_string);
+            return 1;
+        }
+    }
+    if (trials < 1) trials = 1;
+    if (max_threads < 1) max_threads = thread::hardware_concurrency();
+    if (max_threads < 1) max_threads = 1;
+    MazeGeneratorBase *generator = NULL;
+    if (width >= 1 && height >= 1 && (long long) width * height < (1LL << 31))
+        generator = make_generator(generator_name, width, height, seed);
+    if (generator == NULL)
+    {
+        fprintf(stderr, "%s", bench_usage_string);
+        return 1;
+    }
+    generator->create_maze();
+    MazeGrid *maze = generator->get_maze();
+    if (braid > 0)
+        maze->braid(braid, seed);
+
+    printf("solver,threads,generator,width,height,braid,trials,median_ms,"
+        "expanded,path_length,mexpanded_per_s,check\n");
+    for (unsigned int s = 0; s < sizeof(solvers) / sizeof(solvers[0]); s++)
+    {
+        if (only != NULL && strcmp(only, solvers[s].name) != 0)
+            continue;
+
+        /* 1, 2, 4, ... threads, and max_threads itself. */
+        for (int threads = 1; threads <= max_threads;
+            threads = (threads * 2 > max_threads && threads < max_threads)
+                ? max_threads : threads * 2)
+        {
+            vector<double> ms;
+            vector<Coordinate> path;
+            long expanded = 0;
+            bool ok = true;
+
+            for (int t = 0; t < trials; t++)
+            {
+                MazeSolverBase *solver = solvers[s].make(threads);
+                chrono::steady_clock::time_point start = chrono::steady_clock::now();
+                solver->solve(maze);
+                chrono::duration<double, milli> elapsed =
+                    chrono::steady_clock::now() - start;
+                ms.push_back(elapsed.count());
+                expanded = solver->get_expanded();
+                path = solver->get_path();
+                delete solver;
+            }
+
+            if (check)
+            {
+                ok = is_valid_path(maze, path);
+                if (solvers[s].shortest)
+                {
+                    if (path_length < 0)
+                        path_length = path.size();
+                    else if (path_length != (long) path.size())
+                        ok = false;
+                }
+            }
+
+            sort(ms.begin(), ms.end());
+            double median = ms[ms.size() / 2];
+            printf("%s,%d,%s,%d,%d,%.3f,%lu,%.3f,%ld,%lu,%.2f,%s\n",
+                solvers[s].name, threads, generator_name, width, height, braid,
+                (unsigned long) ms.size(), median, expanded,
+                (unsigned long) path.size(), expanded / median / 1e3,
+                check ? (ok ? "ok" : "FAILED") : "-");
+            fflush(stdout);
+            all_ok = all_ok && ok;
+
+            if (!solvers[s].parallel)
+                break;
+        }
+    }
+
+    delete generator;
+    return all_ok ? 0 : 1;
+}
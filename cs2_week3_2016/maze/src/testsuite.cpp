@@ -149,6 +149,38 @@ int main()
     printf("Enqueuing Coordinate (2, 1)\n");
     queue->enqueue(Coordinate(2, 1));
 
+	printf("\n");
+	// The queue keeps its items in a ring, so check that they stay in
+	// order as the ring wraps around and grows
+	printf("Testing CoordinateQueue wrapping around and growing\n");
+	int next_in = 0, next_out = 0;
+	bool in_order = true;
+	// The three coordinates above are still in the queue
+	queue->dequeue();
+	queue->dequeue();
+	queue->dequeue();
+	for (int round = 1; round <= 50; round++) {
+		// Enqueue one more than is dequeued, so the queue slowly grows
+		for (int i = 0; i < round % 7 + 1; i++, next_in++) {
+			queue->enqueue(Coordinate(next_in, -next_in));
+		}
+		for (int i = 0; i < round % 7; i++, next_out++) {
+			c = queue->dequeue();
+			if (c.x != next_out || c.y != -next_out)
+				in_order = false;
+		}
+	}
+	while (!queue->is_empty()) {
+		c = queue->dequeue();
+		if (c.x != next_out || c.y != -next_out)
+			in_order = false;
+		next_out++;
+	}
+	if (in_order && next_out == next_in)
+		printf("Dequeued %d coordinates in order\n", next_out);
+	else
+		printf("Coordinates came out of order!\n");
+
 
     delete queue;
     delete stack;